@@ -0,0 +1,899 @@
+/**
+ * @file StringExtensionsBenchmarks.cpp
+ *
+ * This module contains benchmarks of the
+ * StringExtensions functions which extend the string library.
+ *
+ * Each benchmark prints the average time taken per operation.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <ctype.h>
+#include <map>
+#include <set>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <sstream>
+#include <string>
+#include <StringExtensions/CharSet.hpp>
+#include <StringExtensions/JoinIov.hpp>
+#include <StringExtensions/MappedLines.hpp>
+#include <StringExtensions/PackedStrings.hpp>
+#include <StringExtensions/Searcher.hpp>
+#include <StringExtensions/StringBuilder.hpp>
+#include <StringExtensions/StringExtensions.hpp>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <limits.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif /* _WIN32 */
+
+namespace {
+
+    /**
+     * This is written by benchmarks with results derived from the
+     * operations measured, so that the compiler can't optimize
+     * the operations away.
+     */
+    volatile size_t sink = 0;
+
+    /**
+     * This function runs the given operation repeatedly, and prints
+     * the average time taken per operation.
+     *
+     * @param[in] name
+     *     This is the name to print for the benchmark.
+     *
+     * @param[in] iterations
+     *     This is the number of times to run the operation.
+     *
+     * @param[in] operation
+     *     This is the operation to measure.
+     */
+    template< typename Operation > void Measure(
+        const char* name,
+        size_t iterations,
+        Operation&& operation
+    ) {
+        operation();
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; ++i) {
+            operation();
+        }
+        const auto stop = std::chrono::steady_clock::now();
+        const auto nanoseconds = std::chrono::duration< double, std::nano >(stop - start).count();
+        printf("%-56s %14.1f ns/op\n", name, nanoseconds / iterations);
+    }
+
+    /**
+     * This function makes a string of the given length, made from
+     * printable characters, where roughly one in every given number
+     * of characters is a caret ('^').
+     *
+     * @param[in] length
+     *     This is the length of the string to make.
+     *
+     * @param[in] caretSpacing
+     *     This is the average number of characters per caret,
+     *     or zero if no carets should be included.
+     *
+     * @return
+     *     The generated string is returned.
+     */
+    std::string MakeText(size_t length, size_t caretSpacing) {
+        std::string text;
+        text.reserve(length);
+        uint32_t state = 12345;
+        for (size_t i = 0; i < length; ++i) {
+            state = state * 1103515245 + 12345;
+            if (
+                (caretSpacing != 0)
+                && ((state >> 16) % caretSpacing == 0)
+            ) {
+                text.push_back('^');
+            } else {
+                text.push_back((char)('a' + (state >> 16) % 26));
+            }
+        }
+        return text;
+    }
+
+    /**
+     * This function compares escaping with the characters to escape
+     * given as a std::set versus a CharSet.
+     */
+    void BenchmarkEscapeCharacterSets() {
+        const std::set< char > stdSet{'^', '!', ' ', '"'};
+        constexpr StringExtensions::CharSet charSet("^! \"");
+        for (const auto caretSpacing: {0, 64}) {
+            const auto text = MakeText(4096, caretSpacing);
+            const auto suffix = (caretSpacing == 0) ? " (4 KiB, clean)" : " (4 KiB, 1/64 escaped)";
+            Measure(
+                (std::string("Escape std::set") + suffix).c_str(),
+                10000,
+                [&]{ sink = sink + StringExtensions::Escape(text, '^', stdSet).length(); }
+            );
+            Measure(
+                (std::string("Escape CharSet") + suffix).c_str(),
+                10000,
+                [&]{ sink = sink + StringExtensions::Escape(text, '^', charSet).length(); }
+            );
+        }
+    }
+
+    /**
+     * This function compares unescaping into a copy
+     * versus unescaping in place.
+     */
+    void BenchmarkUnescape() {
+        const auto text = StringExtensions::Escape(MakeText(65536, 64), '^', StringExtensions::CharSet("^"));
+        Measure(
+            "Unescape (64 KiB, 1/64 escaped)",
+            1000,
+            [&]{ sink = sink + StringExtensions::Unescape(text, '^').length(); }
+        );
+        std::string copy;
+        copy.reserve(text.length());
+        Measure(
+            "UnescapeInPlace (64 KiB, 1/64 escaped, including copy)",
+            1000,
+            [&]{
+                copy.assign(text);
+                StringExtensions::UnescapeInPlace(copy, '^');
+                sink = sink + copy.length();
+            }
+        );
+    }
+
+    /**
+     * This function measures the dialect-specific escapers.
+     */
+    void BenchmarkEscapeDialects() {
+        for (const auto caretSpacing: {0, 64}) {
+            auto text = MakeText(4096, caretSpacing);
+            for (auto& c: text) {
+                if (c == '^') {
+                    c = '\n';
+                }
+            }
+            const auto suffix = (caretSpacing == 0) ? " (4 KiB, clean)" : " (4 KiB, 1/64 escaped)";
+            Measure(
+                (std::string("EscapeJson") + suffix).c_str(),
+                10000,
+                [&]{ sink = sink + StringExtensions::EscapeJson(text).length(); }
+            );
+            Measure(
+                (std::string("EscapeCLiteral") + suffix).c_str(),
+                10000,
+                [&]{ sink = sink + StringExtensions::EscapeCLiteral(text).length(); }
+            );
+        }
+    }
+
+    /**
+     * This function makes a line of the given number of
+     * comma-separated fields.
+     *
+     * @param[in] numFields
+     *     This is the number of fields to put in the line.
+     *
+     * @return
+     *     The generated line is returned.
+     */
+    std::string MakeFields(size_t numFields) {
+        std::string line;
+        for (size_t i = 0; i < numFields; ++i) {
+            if (i > 0) {
+                line += ", ";
+            }
+            line += "field" + std::to_string(i);
+        }
+        return line;
+    }
+
+    /**
+     * This function measures splitting lines of different numbers of
+     * fields, to show how the time per field scales with line length.
+     */
+    void BenchmarkSplitScaling() {
+        for (const size_t numFields: {1000, 10000}) {
+            const auto line = MakeFields(numFields);
+            const auto iterations = 10000000 / line.length() + 1;
+            const auto suffix = " (" + std::to_string(numFields) + " fields)";
+            Measure(
+                ("Split char" + suffix).c_str(),
+                iterations,
+                [&]{ sink = sink + StringExtensions::Split(line, ',').size(); }
+            );
+            Measure(
+                ("Split string" + suffix).c_str(),
+                iterations,
+                [&]{ sink = sink + StringExtensions::Split(line, ", ").size(); }
+            );
+            Measure(
+                ("SplitView char" + suffix).c_str(),
+                iterations,
+                [&]{ sink = sink + StringExtensions::SplitView(line, ',').size(); }
+            );
+            Measure(
+                ("SplitView string" + suffix).c_str(),
+                iterations,
+                [&]{ sink = sink + StringExtensions::SplitView(line, ", ").size(); }
+            );
+        }
+    }
+
+    /**
+     * This function compares splitting one line after another into new
+     * collections versus reusing the same collection.
+     */
+    void BenchmarkSplitInto() {
+        const auto line = MakeFields(16);
+        Measure(
+            "Split per line (16 fields)",
+            100000,
+            [&]{ sink = sink + StringExtensions::Split(line, ',').size(); }
+        );
+        std::vector< std::string > values;
+        Measure(
+            "SplitInto reused collection (16 fields)",
+            100000,
+            [&]{
+                StringExtensions::SplitInto(line, ',', values);
+                sink = sink + values.size();
+            }
+        );
+    }
+
+    /**
+     * This function compares finding short and long needles in a large
+     * haystack using std::string::find versus a Searcher.
+     */
+    void BenchmarkFind() {
+        // Lines of text with frequent dashes, so that the first bytes
+        // of the needles occur often without the needles matching.
+        auto haystack = MakeText(1 << 20, 8);
+        for (size_t i = 0; i < haystack.length(); ++i) {
+            if (haystack[i] == '^') {
+                haystack[i] = '-';
+            } else if (i % 64 == 62) {
+                haystack[i] = '\r';
+            } else if (i % 64 == 63) {
+                haystack[i] = '\n';
+            }
+        }
+        for (const std::string needle: {"\r\n--", "--boundary", "\r\n--multipart-boundary-0123456789abcdefghijklmnop--"}) {
+            const auto text = haystack + needle;
+            const auto suffix = " (1 MiB, " + std::to_string(needle.length()) + "-byte needle)";
+            Measure(
+                ("std::string::find" + suffix).c_str(),
+                200,
+                [&]{ sink = sink + text.find(needle); }
+            );
+            const StringExtensions::Searcher searcher(needle);
+            Measure(
+                ("Searcher::Find" + suffix).c_str(),
+                200,
+                [&]{ sink = sink + searcher.Find(text); }
+            );
+        }
+    }
+
+    /**
+     * This function compares splitting a line at any of several delimiter
+     * characters by splitting it repeatedly, once per delimiter, versus
+     * splitting it once at a CharSet.
+     */
+    void BenchmarkSplitCharSet() {
+        const char delimiters[] = " \t,;";
+        std::string line;
+        for (size_t i = 0; i < 10000; ++i) {
+            line += "field" + std::to_string(i);
+            line += delimiters[i % 4];
+        }
+        Measure(
+            "Split once per delimiter (10000 fields)",
+            100,
+            [&]{
+                std::vector< std::string > pieces{line};
+                for (size_t i = 0; i < 4; ++i) {
+                    std::vector< std::string > nextPieces;
+                    for (const auto& piece: pieces) {
+                        for (auto& nextPiece: StringExtensions::Split(piece, delimiters[i])) {
+                            nextPieces.push_back(std::move(nextPiece));
+                        }
+                    }
+                    pieces = std::move(nextPieces);
+                }
+                sink = sink + pieces.size();
+            }
+        );
+        constexpr StringExtensions::CharSet delimiterSet(" \t,;");
+        Measure(
+            "Split CharSet (10000 fields)",
+            100,
+            [&]{ sink = sink + StringExtensions::Split(line, delimiterSet).size(); }
+        );
+        Measure(
+            "SplitView CharSet (10000 fields)",
+            100,
+            [&]{ sink = sink + StringExtensions::SplitView(line, delimiterSet).size(); }
+        );
+    }
+
+    /**
+     * This function measures splitting a long CSV record with quoted
+     * fields, compared with splitting the same record without regard
+     * to quotes.
+     */
+    void BenchmarkSplitQuoted() {
+        std::string record;
+        for (size_t i = 0; record.length() < (1 << 20); ++i) {
+            if (i % 4 == 0) {
+                record += "\"Smith, \"\"J\"\"\",";
+            } else {
+                record += std::to_string(i * 7919) + ",";
+            }
+        }
+        Measure(
+            "SplitView char, unaware of quotes (1 MiB)",
+            20,
+            [&]{ sink = sink + StringExtensions::SplitView(record, ',').size(); }
+        );
+        Measure(
+            "SplitQuoted (1 MiB)",
+            20,
+            [&]{ sink = sink + StringExtensions::SplitQuoted(record).size(); }
+        );
+    }
+
+    /**
+     * This function measures splitting a large buffer of lines
+     * using different numbers of threads.
+     */
+    void BenchmarkSplitParallel() {
+        std::string text;
+        for (size_t i = 0; text.length() < (64 << 20); ++i) {
+            text += "line " + std::to_string(i * 7919) + " of the buffer\n";
+        }
+        Measure(
+            "SplitView (64 MiB)",
+            5,
+            [&]{ sink = sink + StringExtensions::SplitView(text, '\n').size(); }
+        );
+        for (const size_t numThreads: {1, 2, 4, 8}) {
+            Measure(
+                ("SplitViewParallel (64 MiB, " + std::to_string(numThreads) + " threads)").c_str(),
+                5,
+                [&]{ sink = sink + StringExtensions::SplitViewParallel(text, '\n', numThreads).size(); }
+            );
+        }
+    }
+
+    /**
+     * This function compares splitting clean data with the default
+     * split policy, which trims every piece, versus a policy which
+     * doesn't trim anything.
+     */
+    void BenchmarkSplitPolicies() {
+        std::string line;
+        for (size_t i = 0; i < 10000; ++i) {
+            line += std::to_string(i * 7919) + ",";
+        }
+        Measure(
+            "SplitView default policy (10000 fields)",
+            1000,
+            [&]{ sink = sink + StringExtensions::SplitView(line, ',').size(); }
+        );
+        Measure(
+            "SplitView raw policy (10000 fields)",
+            1000,
+            [&]{ sink = sink + StringExtensions::SplitView< StringExtensions::RawSplitPolicy >(line, ',').size(); }
+        );
+    }
+
+    /**
+     * This function compares reading the lines of a file by reading
+     * the whole file into a string and splitting it, versus mapping
+     * the file into memory with MappedLines.
+     */
+    void BenchmarkMappedLines() {
+        const std::string path = "StringExtensionsBenchmarks.txt";
+        std::string text;
+        for (size_t i = 0; text.length() < (64 << 20); ++i) {
+            text += "line " + std::to_string(i * 7919) + " of the file\n";
+        }
+        auto file = fopen(path.c_str(), "wb");
+        if (file == NULL) {
+            return;
+        }
+        (void)fwrite(text.data(), 1, text.length(), file);
+        (void)fclose(file);
+        text = std::string();
+        Measure(
+            "Read file and SplitView lines (64 MiB)",
+            5,
+            [&]{
+                std::string contents;
+                const auto input = fopen(path.c_str(), "rb");
+                char buffer[65536];
+                size_t amountRead;
+                while ((amountRead = fread(buffer, 1, sizeof(buffer), input)) > 0) {
+                    contents.append(buffer, amountRead);
+                }
+                (void)fclose(input);
+                sink = sink + StringExtensions::SplitView(contents, '\n').size();
+            }
+        );
+        Measure(
+            "MappedLines (64 MiB)",
+            5,
+            [&]{
+                StringExtensions::MappedLines lines;
+                (void)lines.Open(path);
+                std::string_view line;
+                while (lines.NextLine(line)) {
+                    sink = sink + line.length();
+                }
+            }
+        );
+        (void)remove(path.c_str());
+    }
+
+    /**
+     * This function compares splitting a line into a vector of strings
+     * versus packed strings, and then stepping through the pieces and
+     * sorting them by index.
+     */
+    void BenchmarkPackedStrings() {
+        std::string line;
+        for (size_t i = 0; i < 100000; ++i) {
+            line += "field" + std::to_string(i * 7919 % 100000) + ",";
+        }
+        const auto copies = StringExtensions::Split(line, ',');
+        const auto packed = StringExtensions::SplitPacked(line, ',');
+        Measure(
+            "Split to vector of strings (100000 fields)",
+            100,
+            [&]{ sink = sink + StringExtensions::Split(line, ',').size(); }
+        );
+        Measure(
+            "SplitPacked (100000 fields)",
+            100,
+            [&]{ sink = sink + StringExtensions::SplitPacked(line, ',').GetSize(); }
+        );
+        Measure(
+            "Iterate vector of strings (100000 fields)",
+            100,
+            [&]{
+                size_t total = 0;
+                for (const auto& piece: copies) {
+                    total += (unsigned char)piece.back();
+                }
+                sink = sink + total;
+            }
+        );
+        Measure(
+            "Iterate packed strings (100000 fields)",
+            100,
+            [&]{
+                size_t total = 0;
+                for (const auto piece: packed) {
+                    total += (unsigned char)piece.back();
+                }
+                sink = sink + total;
+            }
+        );
+        std::vector< uint32_t > indices(copies.size());
+        Measure(
+            "Sort indices of vector of strings (100000 fields)",
+            20,
+            [&]{
+                for (size_t i = 0; i < indices.size(); ++i) {
+                    indices[i] = (uint32_t)i;
+                }
+                std::sort(
+                    indices.begin(),
+                    indices.end(),
+                    [&](uint32_t a, uint32_t b){ return copies[a] < copies[b]; }
+                );
+                sink = sink + indices[0];
+            }
+        );
+        Measure(
+            "Sort indices of packed strings (100000 fields)",
+            20,
+            [&]{
+                for (size_t i = 0; i < indices.size(); ++i) {
+                    indices[i] = (uint32_t)i;
+                }
+                std::sort(
+                    indices.begin(),
+                    indices.end(),
+                    [&](uint32_t a, uint32_t b){ return packed[a] < packed[b]; }
+                );
+                sink = sink + indices[0];
+            }
+        );
+    }
+
+    /**
+     * This function compares joining strings with a string stream,
+     * as Join used to, versus the Join function, joining views
+     * directly versus first copying them into strings, and appending
+     * the result of Join to a string versus joining into the string.
+     */
+    void BenchmarkJoin() {
+        const auto pieces = StringExtensions::Split(MakeFields(10000), ',');
+        const std::vector< std::string_view > views(pieces.begin(), pieces.end());
+        Measure(
+            "Join with std::ostringstream (10000 pieces)",
+            1000,
+            [&]{
+                std::ostringstream builder;
+                bool first = true;
+                for (const auto& piece: pieces) {
+                    if (first) {
+                        first = false;
+                    } else {
+                        builder << ',';
+                    }
+                    builder << piece;
+                }
+                sink = sink + builder.str().length();
+            }
+        );
+        Measure(
+            "Join (10000 pieces)",
+            1000,
+            [&]{ sink = sink + StringExtensions::Join(pieces, ',').length(); }
+        );
+        Measure(
+            "Copy views to strings, then Join (10000 pieces)",
+            1000,
+            [&]{
+                const std::vector< std::string > copies(views.begin(), views.end());
+                sink = sink + StringExtensions::Join(copies, ',').length();
+            }
+        );
+        Measure(
+            "Join views (10000 pieces)",
+            1000,
+            [&]{ sink = sink + StringExtensions::Join(views, ',').length(); }
+        );
+        const std::vector< std::string_view > record(views.begin(), views.begin() + 16);
+        Measure(
+            "Append Join result per record (16 pieces)",
+            100000,
+            [&]{
+                std::string out = "record: ";
+                out += StringExtensions::Join(record, ',');
+                sink = sink + out.length();
+            }
+        );
+        std::string out;
+        Measure(
+            "JoinInto reused string per record (16 pieces)",
+            100000,
+            [&]{
+                out = "record: ";
+                StringExtensions::JoinInto(out, record, ',');
+                sink = sink + out.length();
+            }
+        );
+    }
+
+    /**
+     * This function compares joining integers by first formatting
+     * them into a vector of strings, versus joining them directly
+     * with the AppendInteger projection.
+     */
+    void BenchmarkJoinProjection() {
+        std::vector< int > numbers;
+        numbers.reserve(10000);
+        for (int i = 0; i < 10000; ++i) {
+            numbers.push_back(i * 7919 - 5000000);
+        }
+        Measure(
+            "Format integers to strings, then Join (10000 pieces)",
+            1000,
+            [&]{
+                std::vector< std::string > formatted;
+                formatted.reserve(numbers.size());
+                for (const auto number: numbers) {
+                    formatted.push_back(std::to_string(number));
+                }
+                sink = sink + StringExtensions::Join(formatted, ',').length();
+            }
+        );
+        Measure(
+            "Join integers with AppendInteger (10000 pieces)",
+            1000,
+            [&]{
+                sink = sink + StringExtensions::Join(
+                    numbers,
+                    ',',
+                    StringExtensions::AppendInteger()
+                ).length();
+            }
+        );
+    }
+#ifndef _WIN32
+    /**
+     * This function writes all the text which the given I/O vectors
+     * point at to the given file descriptor, in batches no larger than
+     * the system allows, picking up where it left off after any
+     * partial write.
+     *
+     * @param[in] fd
+     *     This is the file descriptor to which to write.
+     *
+     * @param[in] vectors
+     *     These are the I/O vectors to write.  They're adjusted
+     *     as the text is written.
+     *
+     * @return
+     *     An indication of whether or not all the text
+     *     was written is returned.
+     */
+    bool WriteAll(
+        int fd,
+        std::vector< struct iovec >& vectors
+    ) {
+        size_t next = 0;
+        while (next < vectors.size()) {
+            const auto batch = std::min(vectors.size() - next, (size_t)IOV_MAX);
+            auto amountWritten = writev(fd, &vectors[next], (int)batch);
+            if (amountWritten < 0) {
+                return false;
+            }
+            while (
+                (next < vectors.size())
+                && ((size_t)amountWritten >= vectors[next].iov_len)
+            ) {
+                amountWritten -= (ssize_t)vectors[next].iov_len;
+                ++next;
+            }
+            if (amountWritten > 0) {
+                vectors[next].iov_base = (char*)vectors[next].iov_base + amountWritten;
+                vectors[next].iov_len -= (size_t)amountWritten;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * This function writes all of the given string to the given file
+     * descriptor, picking up where it left off after any partial write.
+     *
+     * @param[in] fd
+     *     This is the file descriptor to which to write.
+     *
+     * @param[in] text
+     *     This is the text to write.
+     *
+     * @return
+     *     An indication of whether or not all the text
+     *     was written is returned.
+     */
+    bool WriteAll(
+        int fd,
+        std::string_view text
+    ) {
+        while (!text.empty()) {
+            const auto amountWritten = write(fd, text.data(), text.length());
+            if (amountWritten < 0) {
+                return false;
+            }
+            text.remove_prefix((size_t)amountWritten);
+        }
+        return true;
+    }
+
+    /**
+     * This function compares writing a large join to a pipe by first
+     * joining the pieces into one string, versus writing the pieces
+     * where they are with JoinIov and writev, for many small pieces
+     * and for fewer large ones.
+     */
+    void BenchmarkJoinIov() {
+        const auto pieces = StringExtensions::Split(MakeFields(100000), ',');
+        int fds[2];
+        if (pipe(fds) != 0) {
+            return;
+        }
+        std::thread reader(
+            [&]{
+                char buffer[65536];
+                while (read(fds[0], buffer, sizeof(buffer)) > 0) {
+                }
+            }
+        );
+        Measure(
+            "Join, then write to pipe (100000 pieces)",
+            100,
+            [&]{
+                const auto joined = StringExtensions::Join(pieces, ", ");
+                sink = sink + (WriteAll(fds[1], joined) ? joined.length() : 0);
+            }
+        );
+        Measure(
+            "JoinIov, then writev to pipe (100000 pieces)",
+            100,
+            [&]{
+                auto vectors = StringExtensions::JoinIov(pieces, ", ");
+                sink = sink + (WriteAll(fds[1], vectors) ? vectors.size() : 0);
+            }
+        );
+        std::vector< std::string > pages;
+        for (size_t i = 0; i < 1000; ++i) {
+            pages.push_back(MakeText(16384, 0));
+        }
+        Measure(
+            "Join, then write to pipe (1000 16 KiB pieces)",
+            20,
+            [&]{
+                const auto joined = StringExtensions::Join(pages, "\n");
+                sink = sink + (WriteAll(fds[1], joined) ? joined.length() : 0);
+            }
+        );
+        Measure(
+            "JoinIov, then writev to pipe (1000 16 KiB pieces)",
+            20,
+            [&]{
+                auto vectors = StringExtensions::JoinIov(pages, "\n");
+                sink = sink + (WriteAll(fds[1], vectors) ? vectors.size() : 0);
+            }
+        );
+        (void)close(fds[1]);
+        reader.join();
+        (void)close(fds[0]);
+    }
+#endif /* _WIN32 */
+
+    /**
+     * This function compares building a string from many small pieces
+     * with a string stream, a std::string, and a StringBuilder, and
+     * measures the Indent and InstantiateTemplate functions, which
+     * build their results with a StringBuilder.
+     */
+    void BenchmarkStringBuilder() {
+        const auto pieces = StringExtensions::Split(MakeFields(100000), ',');
+        Measure(
+            "Build with std::ostringstream (100000 pieces)",
+            100,
+            [&]{
+                std::ostringstream builder;
+                for (const auto& piece: pieces) {
+                    builder << piece << ';';
+                }
+                sink = sink + builder.str().length();
+            }
+        );
+        Measure(
+            "Build with std::string (100000 pieces)",
+            100,
+            [&]{
+                std::string builder;
+                for (const auto& piece: pieces) {
+                    builder += piece;
+                    builder += ';';
+                }
+                sink = sink + builder.length();
+            }
+        );
+        Measure(
+            "Build with StringBuilder (100000 pieces)",
+            100,
+            [&]{
+                StringExtensions::StringBuilder builder;
+                for (const auto& piece: pieces) {
+                    builder.Append(piece);
+                    builder.Append(';');
+                }
+                sink = sink + builder.ToString().length();
+            }
+        );
+        std::string lines;
+        for (size_t i = 0; i < 1000; ++i) {
+            lines += MakeText(60, 0);
+            lines += "\r\n";
+        }
+        Measure(
+            "Indent (1000 lines)",
+            100,
+            [&]{ sink = sink + StringExtensions::Indent(lines, 4).length(); }
+        );
+        std::string templateText;
+        for (size_t i = 0; i < 1000; ++i) {
+            templateText += "Dear ${name}, you owe \\$${amount} as of ${date}.\r\n";
+        }
+        const std::map< std::string, std::string > variables{
+            {"name", "Alex"},
+            {"amount", "42.00"},
+            {"date", "2019-04-01"},
+        };
+        Measure(
+            "InstantiateTemplate (3000 substitutions)",
+            100,
+            [&]{
+                sink = sink + StringExtensions::InstantiateTemplate(
+                    templateText,
+                    variables
+                ).length();
+            }
+        );
+    }
+
+    /**
+     * This function compares converting mixed-case text to lower case
+     * by calling tolower for each character, as ToLower used to,
+     * versus the ToLower and ToLowerInPlace functions, for a short
+     * string about the size of a header name and for a longer one.
+     */
+    void BenchmarkCaseConversion() {
+        for (const auto length: {24, 4096}) {
+            auto text = MakeText(length, 0);
+            for (size_t i = 0; i < text.length(); i += 3) {
+                text[i] = (char)(text[i] - 'a' + 'A');
+            }
+            const auto suffix = " (" + std::to_string(length) + " bytes)";
+            Measure(
+                ("ToLower with tolower per character" + suffix).c_str(),
+                100000,
+                [&]{
+                    std::string lower;
+                    lower.reserve(text.size());
+                    for (char c: text) {
+                        lower.push_back(tolower(c));
+                    }
+                    sink = sink + lower.length();
+                }
+            );
+            Measure(
+                ("ToLower" + suffix).c_str(),
+                100000,
+                [&]{ sink = sink + StringExtensions::ToLower(text).length(); }
+            );
+            auto copy = text;
+            Measure(
+                ("ToLowerInPlace" + suffix).c_str(),
+                100000,
+                [&]{
+                    StringExtensions::ToLowerInPlace(copy);
+                    sink = sink + (size_t)copy[0];
+                }
+            );
+        }
+    }
+}
+
+int main() {
+    BenchmarkEscapeCharacterSets();
+    BenchmarkUnescape();
+    BenchmarkEscapeDialects();
+    BenchmarkSplitScaling();
+    BenchmarkSplitInto();
+    BenchmarkFind();
+    BenchmarkSplitCharSet();
+    BenchmarkSplitQuoted();
+    BenchmarkSplitParallel();
+    BenchmarkSplitPolicies();
+    BenchmarkMappedLines();
+    BenchmarkPackedStrings();
+    BenchmarkJoin();
+    BenchmarkJoinProjection();
+#ifndef _WIN32
+    BenchmarkJoinIov();
+#endif /* _WIN32 */
+    BenchmarkStringBuilder();
+    BenchmarkCaseConversion();
+    return 0;
+}
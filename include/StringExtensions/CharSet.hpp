@@ -0,0 +1,190 @@
+#pragma once
+
+/**
+ * @file CharSet.hpp
+ *
+ * This module declares the StringExtensions::CharSet class.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <set>
+#include <stddef.h>
+#include <stdint.h>
+#include <string_view>
+
+namespace StringExtensions {
+
+    /**
+     * This class represents a set of characters as a 256-bit bitmap,
+     * so that testing whether or not a character is a member of the set
+     * is a single table lookup.  Sets can be constructed at compile time.
+     */
+    class CharSet {
+        // Public methods
+    public:
+        /**
+         * This constructs an empty set.
+         */
+        constexpr CharSet() = default;
+
+        /**
+         * This constructs a set containing each of the given characters.
+         *
+         * The constructor is explicit so that a string literal passed
+         * where either a delimiter string or a set of delimiter
+         * characters would do is not ambiguous.
+         *
+         * @param[in] characters
+         *     These are the characters to put in the set.
+         */
+        explicit constexpr CharSet(std::string_view characters) {
+            for (auto c: characters) {
+                Add(c);
+            }
+        }
+
+        /**
+         * This constructs a set containing each of the characters
+         * of the given null-terminated string.
+         *
+         * @param[in] characters
+         *     These are the characters to put in the set.
+         */
+        explicit constexpr CharSet(const char* characters)
+            : CharSet(std::string_view(characters))
+        {
+        }
+
+        /**
+         * This constructs a set containing each of the given characters.
+         *
+         * @param[in] characters
+         *     These are the characters to put in the set.
+         */
+        explicit CharSet(const std::set< char >& characters) {
+            for (auto c: characters) {
+                Add(c);
+            }
+        }
+
+        /**
+         * This method adds the given character to the set.
+         *
+         * @param[in] c
+         *     This is the character to add to the set.
+         *
+         * @return
+         *     A reference to the set is returned.
+         */
+        constexpr CharSet& Add(char c) {
+            const auto index = (uint8_t)c;
+            bits_[index / 64] |= ((uint64_t)1 << (index % 64));
+            return *this;
+        }
+
+        /**
+         * This method adds every character from the given first character
+         * through the given last character, inclusive, to the set.
+         *
+         * @param[in] first
+         *     This is the first character to add to the set.
+         *
+         * @param[in] last
+         *     This is the last character to add to the set.
+         *
+         * @return
+         *     A reference to the set is returned.
+         */
+        constexpr CharSet& AddRange(char first, char last) {
+            for (unsigned int i = (uint8_t)first; i <= (uint8_t)last; ++i) {
+                Add((char)i);
+            }
+            return *this;
+        }
+
+        /**
+         * This method determines whether or not the given
+         * character is a member of the set.
+         *
+         * @param[in] c
+         *     This is the character to look up.
+         *
+         * @return
+         *     An indication of whether or not the given character
+         *     is a member of the set is returned.
+         */
+        constexpr bool Contains(char c) const {
+            const auto index = (uint8_t)c;
+            return ((bits_[index / 64] >> (index % 64)) & 1) != 0;
+        }
+
+        /**
+         * This method returns the number of characters in the set.
+         *
+         * @return
+         *     The number of characters in the set is returned.
+         */
+        constexpr size_t GetSize() const {
+            size_t size = 0;
+            for (auto word: bits_) {
+                while (word != 0) {
+                    word &= word - 1;
+                    ++size;
+                }
+            }
+            return size;
+        }
+
+        /**
+         * This method stores the characters in the set, in order of
+         * their unsigned values, into the given array, stopping
+         * if the array fills up.
+         *
+         * @param[out] members
+         *     This is where to store the characters in the set.
+         *
+         * @param[in] maxMembers
+         *     This is the maximum number of characters to store.
+         *
+         * @return
+         *     The number of characters stored is returned.
+         */
+        constexpr size_t GetMembers(char* members, size_t maxMembers) const {
+            size_t numMembers = 0;
+            for (size_t i = 0; i < 4; ++i) {
+                auto word = bits_[i];
+                for (size_t bit = 0; word != 0; ++bit, word >>= 1) {
+                    if ((word & 1) != 0) {
+                        if (numMembers == maxMembers) {
+                            return numMembers;
+                        }
+                        members[numMembers++] = (char)(i * 64 + bit);
+                    }
+                }
+            }
+            return numMembers;
+        }
+
+        /**
+         * This method determines whether or not the set is empty.
+         *
+         * @return
+         *     An indication of whether or not the set is empty is returned.
+         */
+        constexpr bool IsEmpty() const {
+            return (
+                (bits_[0] | bits_[1] | bits_[2] | bits_[3]) == 0
+            );
+        }
+
+        // Private properties
+    private:
+        /**
+         * This is the bitmap holding one bit per possible character,
+         * indexed by the unsigned value of the character.
+         */
+        uint64_t bits_[4] = {0, 0, 0, 0};
+    };
+
+}
@@ -0,0 +1,182 @@
+#pragma once
+
+/**
+ * @file ComponentTree.hpp
+ *
+ * This module declares the StringExtensions::ComponentTree class.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <memory>
+#include <stddef.h>
+#include <string_view>
+
+namespace StringExtensions {
+
+    /**
+     * This class represents a composite string, such as
+     * "{abc, [1, 2, 3], (x, y)}", as a tree of delimited "components",
+     * using the same delimiter rules as the ParseComponent function.
+     *
+     * Nodes of the tree refer to substrings of the original text rather
+     * than copies, and the children of a node are only discovered the
+     * first time they are accessed.  This means that the text given to
+     * the tree must outlive the tree and all nodes obtained from it.
+     */
+    class ComponentTree {
+        // Types
+    private:
+        /**
+         * This is the type of structure that holds the state of a
+         * single node of the tree.  It is defined in the implementation
+         * and declared here to ensure that it is scoped inside the class.
+         */
+        struct Record;
+
+        /**
+         * This is the type of structure that contains the private
+         * properties of the instance.  It is defined in the implementation
+         * and declared here to ensure that it is scoped inside the class.
+         */
+        struct Impl;
+
+    public:
+        /**
+         * This is a lightweight handle to one node of the tree.
+         *
+         * A node whose text begins with one of the opening delimiters
+         * '[', '{', '(', or '<' is a "container", whose children are
+         * the comma-separated components between its opening delimiter
+         * and the matching closing delimiter, with any whitespace around
+         * each child trimmed off.  Every other node has no children.
+         *
+         * Nodes remain valid for the lifetime of the tree that
+         * produced them.
+         */
+        class Node {
+        public:
+            /**
+             * This constructs a "null" node, which does not
+             * refer to any part of any tree.
+             */
+            Node() = default;
+
+            /**
+             * This method returns the text of the node.
+             *
+             * @return
+             *     The text of the node is returned, as a view into
+             *     the original text given to the tree.
+             */
+            std::string_view GetText() const;
+
+            /**
+             * This method returns the number of children of the node,
+             * discovering them first if they have not been accessed yet.
+             *
+             * @return
+             *     The number of children of the node is returned.
+             */
+            size_t GetNumChildren() const;
+
+            /**
+             * This method returns the child of the node at the given
+             * index, discovering the children first if they have not
+             * been accessed yet.
+             *
+             * @param[in] index
+             *     This is the index of the child to return.
+             *
+             * @return
+             *     The child at the given index is returned.
+             *     If there is no such child, a null node is returned.
+             */
+            Node GetChild(size_t index) const;
+
+            /**
+             * This is a shorthand for the GetChild method.
+             *
+             * @param[in] index
+             *     This is the index of the child to return.
+             *
+             * @return
+             *     The child at the given index is returned.
+             *     If there is no such child, a null node is returned.
+             */
+            Node operator[](size_t index) const;
+
+            /**
+             * This method indicates whether or not the node
+             * refers to part of a tree.
+             *
+             * @return
+             *     An indication of whether or not the node refers
+             *     to part of a tree is returned.
+             */
+            explicit operator bool() const;
+
+        private:
+            friend class ComponentTree;
+
+            /**
+             * This constructs a node referring to the given
+             * record of the given tree.
+             *
+             * @param[in] tree
+             *     This is the tree which owns the node's record.
+             *
+             * @param[in] record
+             *     This is the record holding the node's state.
+             */
+            Node(Impl* tree, Record* record);
+
+            /**
+             * This is the tree which owns the node's record.
+             */
+            Impl* tree_ = nullptr;
+
+            /**
+             * This is the record holding the node's state.
+             */
+            Record* record_ = nullptr;
+        };
+
+        // Lifecycle management
+    public:
+        ~ComponentTree() noexcept;
+        ComponentTree(const ComponentTree&) = delete;
+        ComponentTree(ComponentTree&&) noexcept;
+        ComponentTree& operator=(const ComponentTree&) = delete;
+        ComponentTree& operator=(ComponentTree&&) noexcept;
+
+        // Public methods
+    public:
+        /**
+         * This constructs a tree for the given text.
+         *
+         * @param[in] text
+         *     This is the composite string to represent as a tree.
+         *     It must outlive the tree and all nodes obtained from it.
+         */
+        explicit ComponentTree(std::string_view text);
+
+        /**
+         * This method returns the root node of the tree, which holds
+         * the entire text given to the tree, with any whitespace around
+         * it trimmed off.
+         *
+         * @return
+         *     The root node of the tree is returned.
+         */
+        Node GetRoot() const;
+
+        // Private properties
+    private:
+        /**
+         * This contains the private properties of the instance.
+         */
+        std::unique_ptr< Impl > impl_;
+    };
+
+}
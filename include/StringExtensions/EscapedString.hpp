@@ -0,0 +1,130 @@
+#pragma once
+
+/**
+ * @file EscapedString.hpp
+ *
+ * This module declares the StringExtensions::EscapedString class.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace StringExtensions {
+
+    /**
+     * This class holds the result of escaping a string, which is either
+     * a view of the original string, when nothing in it needed escaping,
+     * or an escaped copy of it owned by the instance.
+     *
+     * When the result is a view, the original string must outlive
+     * the instance.
+     */
+    class EscapedString {
+        // Public methods
+    public:
+        /**
+         * This constructs an empty result.
+         */
+        EscapedString() = default;
+
+        /**
+         * This constructs a result which is a view of the given string.
+         *
+         * @param[in] original
+         *     This is the string to view.
+         */
+        explicit EscapedString(std::string_view original)
+            : original_(original)
+        {
+        }
+
+        /**
+         * This constructs a result which owns the given string.
+         *
+         * @param[in] escaped
+         *     This is the string to own.
+         */
+        explicit EscapedString(std::string&& escaped)
+            : escaped_(std::move(escaped))
+            , owned_(true)
+        {
+        }
+
+        /**
+         * This method indicates whether or not the instance owns
+         * an escaped copy of the original string, rather than
+         * viewing the original string.
+         *
+         * @return
+         *     An indication of whether or not the instance owns
+         *     an escaped copy of the original string is returned.
+         */
+        bool IsOwned() const {
+            return owned_;
+        }
+
+        /**
+         * This method returns a view of the escaped string.
+         *
+         * @return
+         *     A view of the escaped string is returned.
+         */
+        std::string_view GetView() const {
+            return (owned_ ? std::string_view(escaped_) : original_);
+        }
+
+        /**
+         * This returns a view of the escaped string.
+         */
+        operator std::string_view() const {
+            return GetView();
+        }
+
+        /**
+         * This method returns a copy of the escaped string.
+         *
+         * @return
+         *     A copy of the escaped string is returned.
+         */
+        std::string ToString() const & {
+            return std::string(GetView());
+        }
+
+        /**
+         * This method returns the escaped string, moving it
+         * out of the instance if it is owned.
+         *
+         * @return
+         *     The escaped string is returned.
+         */
+        std::string ToString() && {
+            if (owned_) {
+                return std::move(escaped_);
+            }
+            return std::string(original_);
+        }
+
+        // Private properties
+    private:
+        /**
+         * This is the original string, if nothing in it needed escaping.
+         */
+        std::string_view original_;
+
+        /**
+         * This is the escaped copy of the original string,
+         * if anything in it needed escaping.
+         */
+        std::string escaped_;
+
+        /**
+         * This indicates whether or not the instance owns
+         * an escaped copy of the original string.
+         */
+        bool owned_ = false;
+    };
+
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+/**
+ * @file Escaper.hpp
+ *
+ * This module declares the StringExtensions::Escaper class.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <memory>
+#include <string_view>
+#include <StringExtensions/CharSet.hpp>
+#include <StringExtensions/Sink.hpp>
+
+namespace StringExtensions {
+
+    /**
+     * This class escapes text in the same way as the Escape function,
+     * except that the text may be given in any number of chunks, and
+     * the escaped text is delivered to a sink as it is produced,
+     * rather than being collected into a string.
+     */
+    class Escaper {
+        // Lifecycle management
+    public:
+        ~Escaper() noexcept;
+        Escaper(const Escaper&) = delete;
+        Escaper(Escaper&&) noexcept;
+        Escaper& operator=(const Escaper&) = delete;
+        Escaper& operator=(Escaper&&) noexcept;
+
+        // Public methods
+    public:
+        /**
+         * This constructs an escaper.
+         *
+         * @param[in] escapeCharacter
+         *     This is the character to put in front of every character
+         *     of the input that is a member of the
+         *     "charactersToEscape" set.
+         *
+         * @param[in] charactersToEscape
+         *     These are the characters that should be escaped in the input.
+         *
+         * @param[in] sink
+         *     This is where to deliver the escaped text.
+         */
+        Escaper(
+            char escapeCharacter,
+            const CharSet& charactersToEscape,
+            Sink sink
+        );
+
+        /**
+         * This method escapes the given chunk of input, delivering
+         * the escaped text to the sink.  Runs of input which need no
+         * escaping are delivered without being copied.
+         *
+         * @param[in] chunk
+         *     This is the next chunk of input to escape.
+         */
+        void Write(std::string_view chunk);
+
+        // Private properties
+    private:
+        /**
+         * This is the type of structure that contains the private
+         * properties of the instance.  It is defined in the implementation
+         * and declared here to ensure that it is scoped inside the class.
+         */
+        struct Impl;
+
+        /**
+         * This contains the private properties of the instance.
+         */
+        std::unique_ptr< Impl > impl_;
+    };
+
+}
@@ -0,0 +1,355 @@
+#pragma once
+
+/**
+ * @file Join.hpp
+ *
+ * This module declares the JoinInto function, the versions of
+ * the Join function which join together any range of strings or
+ * projections of other values, and the projections provided
+ * for use with them.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <charconv>
+#include <limits>
+#include <stddef.h>
+#include <string.h>
+#include <string>
+#include <string_view>
+
+namespace StringExtensions {
+
+    /**
+     * This function joins together the given range of smaller strings,
+     * with each piece separated by the given delimiter string, appending
+     * the result to the given string.  The length of the result is
+     * worked out first, so that the string grows at most once, and
+     * then each piece is copied into place.  The string grows in the
+     * usual way, geometrically, so that appending to it repeatedly
+     * remains efficient.
+     *
+     * @param[in,out] out
+     *     This is the string to which to append the result.
+     *
+     * @param[in] pieces
+     *     This is the range of smaller strings to join together.
+     *     Its elements may be std::string, std::string_view, or
+     *     null-terminated strings (const char*), or anything else
+     *     convertible to std::string_view.  It's stepped through twice.
+     *
+     * @param[in] d
+     *     This is the delimiter string to put between each piece.
+     */
+    template< typename Range > void JoinInto(
+        std::string& out,
+        const Range& pieces,
+        std::string_view d
+    ) {
+        size_t length = 0;
+        size_t numPieces = 0;
+        for (const auto& piece: pieces) {
+            length += std::string_view(piece).length();
+            ++numPieces;
+        }
+        if (numPieces > 1) {
+            length += d.length() * (numPieces - 1);
+        }
+        if (length == 0) {
+            return;
+        }
+
+        // Empty views may not point anywhere, so they're skipped,
+        // since memcpy must be given valid pointers even when
+        // copying nothing.
+        const auto start = out.length();
+        out.resize(start + length);
+        auto next = &out[start];
+        bool first = true;
+        for (const auto& piece: pieces) {
+            if (first) {
+                first = false;
+            } else if (!d.empty()) {
+                (void)memcpy(next, d.data(), d.length());
+                next += d.length();
+            }
+            const std::string_view view(piece);
+            if (!view.empty()) {
+                (void)memcpy(next, view.data(), view.length());
+                next += view.length();
+            }
+        }
+    }
+
+    /**
+     * This function joins together the given range of smaller strings,
+     * with each piece separated by the given delimiter character,
+     * appending the result to the given string, which grows only once.
+     *
+     * @param[in,out] out
+     *     This is the string to which to append the result.
+     *
+     * @param[in] pieces
+     *     This is the range of smaller strings to join together.
+     *     Its elements may be std::string, std::string_view, or
+     *     null-terminated strings (const char*), or anything else
+     *     convertible to std::string_view.  It's stepped through twice.
+     *
+     * @param[in] d
+     *     This is the delimiter character to put between each piece.
+     */
+    template< typename Range > void JoinInto(
+        std::string& out,
+        const Range& pieces,
+        char d
+    ) {
+        JoinInto(out, pieces, std::string_view(&d, 1));
+    }
+
+    /**
+     * This function joins together the given range of smaller strings
+     * into one bigger string, with each piece separated by the given
+     * delimiter string, allocating the result only once.
+     *
+     * @param[in] pieces
+     *     This is the range of smaller strings to join together.
+     *     Its elements may be std::string, std::string_view, or
+     *     null-terminated strings (const char*), or anything else
+     *     convertible to std::string_view.  It's stepped through twice.
+     *
+     * @param[in] d
+     *     This is the delimiter string to put between each piece.
+     *
+     * @return
+     *     A single larger string formed by joining together the given
+     *     pieces separated by delimiters is returned.
+     */
+    template< typename Range > std::string Join(
+        const Range& pieces,
+        std::string_view d
+    ) {
+        std::string result;
+        JoinInto(result, pieces, d);
+        return result;
+    }
+
+    /**
+     * This function joins together the given range of smaller strings
+     * into one bigger string, with each piece separated by the given
+     * delimiter character, allocating the result only once.
+     *
+     * @param[in] pieces
+     *     This is the range of smaller strings to join together.
+     *     Its elements may be std::string, std::string_view, or
+     *     null-terminated strings (const char*), or anything else
+     *     convertible to std::string_view.  It's stepped through twice.
+     *
+     * @param[in] d
+     *     This is the delimiter character to put between each piece.
+     *
+     * @return
+     *     A single larger string formed by joining together the given
+     *     pieces separated by delimiters is returned.
+     */
+    template< typename Range > std::string Join(
+        const Range& pieces,
+        char d
+    ) {
+        return Join(pieces, std::string_view(&d, 1));
+    }
+
+    /**
+     * This is a projection for use with Join and JoinInto, which
+     * appends the decimal representation of each integer joined.
+     */
+    struct AppendInteger {
+        /**
+         * This appends the decimal representation of
+         * the given integer to the given string.
+         *
+         * @param[in,out] out
+         *     This is the string to which to append the integer.
+         *
+         * @param[in] value
+         *     This is the integer to append.
+         */
+        template< typename Integer > void operator()(
+            std::string& out,
+            Integer value
+        ) const {
+            char buffer[std::numeric_limits< Integer >::digits10 + 3];
+            const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+            out.append(buffer, (size_t)(result.ptr - buffer));
+        }
+    };
+
+    /**
+     * This is a projection for use with Join and JoinInto, which appends
+     * a member of each object joined that converts to std::string_view.
+     * Instances are made with the AppendMember function.
+     */
+    template< typename Class, typename Member > struct MemberProjection {
+        /**
+         * This selects the member to append.
+         */
+        Member Class::* member;
+
+        /**
+         * This appends the selected member of the given
+         * object to the given string.
+         *
+         * @param[in,out] out
+         *     This is the string to which to append the member.
+         *
+         * @param[in] object
+         *     This is the object whose member is appended.
+         */
+        void operator()(
+            std::string& out,
+            const Class& object
+        ) const {
+            out.append(std::string_view(object.*member));
+        }
+    };
+
+    /**
+     * This function makes a projection for use with Join and JoinInto,
+     * which appends the given member of each object joined.
+     *
+     * @param[in] member
+     *     This selects the member to append.  It must convert
+     *     to std::string_view.
+     *
+     * @return
+     *     The projection is returned.
+     */
+    template< typename Class, typename Member > MemberProjection< Class, Member > AppendMember(
+        Member Class::* member
+    ) {
+        return MemberProjection< Class, Member >{member};
+    }
+
+    /**
+     * This function joins together the text of the given range of
+     * values, with each piece separated by the given delimiter string,
+     * appending the result to the given string.  The text of each value
+     * is appended directly by the given projection, so no strings need
+     * be made for the values first.
+     *
+     * @param[in,out] out
+     *     This is the string to which to append the result.
+     *
+     * @param[in] values
+     *     This is the range of values to join together.
+     *
+     * @param[in] d
+     *     This is the delimiter string to put between each piece.
+     *
+     * @param[in] projection
+     *     This is called with the string and each value in turn,
+     *     and appends the text of the value to the string.
+     */
+    template< typename Range, typename Projection > void JoinInto(
+        std::string& out,
+        const Range& values,
+        std::string_view d,
+        Projection&& projection
+    ) {
+        bool first = true;
+        for (const auto& value: values) {
+            if (first) {
+                first = false;
+            } else {
+                out.append(d);
+            }
+            projection(out, value);
+        }
+    }
+
+    /**
+     * This function joins together the text of the given range of
+     * values, with each piece separated by the given delimiter character,
+     * appending the result to the given string.  The text of each value
+     * is appended directly by the given projection.
+     *
+     * @param[in,out] out
+     *     This is the string to which to append the result.
+     *
+     * @param[in] values
+     *     This is the range of values to join together.
+     *
+     * @param[in] d
+     *     This is the delimiter character to put between each piece.
+     *
+     * @param[in] projection
+     *     This is called with the string and each value in turn,
+     *     and appends the text of the value to the string.
+     */
+    template< typename Range, typename Projection > void JoinInto(
+        std::string& out,
+        const Range& values,
+        char d,
+        Projection&& projection
+    ) {
+        JoinInto(out, values, std::string_view(&d, 1), projection);
+    }
+
+    /**
+     * This function joins together the text of the given range of
+     * values into one string, with each piece separated by the given
+     * delimiter string.  The text of each value is appended directly
+     * by the given projection.
+     *
+     * @param[in] values
+     *     This is the range of values to join together.
+     *
+     * @param[in] d
+     *     This is the delimiter string to put between each piece.
+     *
+     * @param[in] projection
+     *     This is called with the string being built and each value
+     *     in turn, and appends the text of the value to the string.
+     *
+     * @return
+     *     A single string formed by joining together the text of the
+     *     given values separated by delimiters is returned.
+     */
+    template< typename Range, typename Projection > std::string Join(
+        const Range& values,
+        std::string_view d,
+        Projection&& projection
+    ) {
+        std::string result;
+        JoinInto(result, values, d, projection);
+        return result;
+    }
+
+    /**
+     * This function joins together the text of the given range of
+     * values into one string, with each piece separated by the given
+     * delimiter character.  The text of each value is appended directly
+     * by the given projection.
+     *
+     * @param[in] values
+     *     This is the range of values to join together.
+     *
+     * @param[in] d
+     *     This is the delimiter character to put between each piece.
+     *
+     * @param[in] projection
+     *     This is called with the string being built and each value
+     *     in turn, and appends the text of the value to the string.
+     *
+     * @return
+     *     A single string formed by joining together the text of the
+     *     given values separated by delimiters is returned.
+     */
+    template< typename Range, typename Projection > std::string Join(
+        const Range& values,
+        char d,
+        Projection&& projection
+    ) {
+        return Join(values, std::string_view(&d, 1), projection);
+    }
+
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+/**
+ * @file JoinIov.hpp
+ *
+ * This module declares the JoinIov function, which is available
+ * only on POSIX systems.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#ifndef _WIN32
+
+#include <stddef.h>
+#include <string_view>
+#include <sys/uio.h>
+#include <vector>
+
+namespace StringExtensions {
+
+    /**
+     * This function lays out the joining together of the given range
+     * of smaller strings, with each piece separated by the given
+     * delimiter string, as an array of I/O vectors suitable for passing
+     * to writev or sendmsg, instead of copying the pieces into one
+     * string.  The vectors point at the pieces themselves and at the one
+     * delimiter, so these must remain valid until the output is done.
+     * Empty pieces and delimiters are left out.
+     *
+     * Systems limit the number of vectors that may be passed to one
+     * call (IOV_MAX), so a long array must be written in batches.
+     * Each vector costs the system some time of its own, so this pays
+     * off only when the pieces are large; small pieces are written
+     * faster by copying them with Join first.
+     *
+     * @param[in] pieces
+     *     This is the range of smaller strings to join together.
+     *     Its elements may be std::string, std::string_view, or
+     *     null-terminated strings (const char*), or anything else
+     *     convertible to std::string_view.
+     *
+     * @param[in] d
+     *     This is the delimiter string to put between each piece.
+     *
+     * @return
+     *     The I/O vectors which together make up the joined
+     *     string are returned.
+     */
+    template< typename Range > std::vector< struct iovec > JoinIov(
+        const Range& pieces,
+        std::string_view d
+    ) {
+        std::vector< struct iovec > vectors;
+        bool first = true;
+        for (const auto& piece: pieces) {
+            if (first) {
+                first = false;
+            } else if (!d.empty()) {
+                vectors.push_back({(void*)d.data(), d.length()});
+            }
+            const std::string_view view(piece);
+            if (!view.empty()) {
+                vectors.push_back({(void*)view.data(), view.length()});
+            }
+        }
+        return vectors;
+    }
+
+}
+
+#endif /* _WIN32 */
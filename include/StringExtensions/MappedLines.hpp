@@ -0,0 +1,126 @@
+#pragma once
+
+/**
+ * @file MappedLines.hpp
+ *
+ * This module declares the StringExtensions::MappedLines class.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace StringExtensions {
+
+    /**
+     * This class reads the lines of a file, one after another, by
+     * mapping the file into memory rather than reading it into a string.
+     * Lines are returned as views into the mapping, so no line is
+     * copied, and pages of the file are only read in as they're reached.
+     *
+     * The operating system is told that the file is read sequentially,
+     * and pages which have been passed are released from time to time,
+     * so that the memory used stays about the same however large the
+     * file is.  Lines which have been passed remain readable, since their
+     * pages are read back in if needed, but doing so costs time.
+     */
+    class MappedLines {
+        // Lifecycle management
+    public:
+        ~MappedLines() noexcept;
+        MappedLines(const MappedLines&) = delete;
+        MappedLines(MappedLines&&) noexcept;
+        MappedLines& operator=(const MappedLines&) = delete;
+        MappedLines& operator=(MappedLines&&) noexcept;
+
+        // Public methods
+    public:
+        /**
+         * This constructs an instance with no file open.
+         */
+        MappedLines();
+
+        /**
+         * This method maps the file at the given path into memory,
+         * closing any file the instance already has open, and starts
+         * reading lines from the beginning of the file.
+         *
+         * @param[in] path
+         *     This is the path of the file to open.
+         *
+         * @return
+         *     An indication of whether or not the file was opened and
+         *     mapped successfully is returned.
+         */
+        bool Open(const std::string& path);
+
+        /**
+         * This method unmaps and closes the file the instance has open,
+         * if any.  Views of lines of the file are no longer valid
+         * afterwards.
+         */
+        void Close();
+
+        /**
+         * This method returns the size of the file the instance has open.
+         *
+         * @return
+         *     The size of the file, in bytes, is returned.
+         *     If no file is open, zero is returned.
+         */
+        size_t GetSize() const;
+
+        /**
+         * This method reads the next line of the file.  The line
+         * terminator, either a line feed or a carriage return and
+         * line feed, is not included.  The file has a last line
+         * only if it doesn't end with a line terminator.
+         *
+         * @param[out] line
+         *     This is where to store a view of the line.
+         *
+         * @return
+         *     An indication of whether or not there was another line
+         *     to read is returned.
+         */
+        bool NextLine(std::string_view& line);
+
+        /**
+         * This method reads the next line of the file and breaks it
+         * at each instance of the given delimiter, in the same way as
+         * SplitInto, storing views of the pieces in the given collection.
+         *
+         * @param[in] d
+         *     This is the delimiter character at which to split the line.
+         *
+         * @param[in,out] fields
+         *     This is where to store views of the pieces of the line.
+         *
+         * @return
+         *     An indication of whether or not there was another line
+         *     to read is returned.
+         */
+        bool NextRecord(
+            char d,
+            std::vector< std::string_view >& fields
+        );
+
+        // Private properties
+    private:
+        /**
+         * This is the type of structure that contains the private
+         * properties of the instance.  It is defined in the implementation
+         * and declared here to ensure that it is scoped inside the class.
+         */
+        struct Impl;
+
+        /**
+         * This contains the private properties of the instance.
+         */
+        std::unique_ptr< Impl > impl_;
+    };
+
+}
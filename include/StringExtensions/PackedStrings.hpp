@@ -0,0 +1,296 @@
+#pragma once
+
+/**
+ * @file PackedStrings.hpp
+ *
+ * This module declares the StringExtensions::PackedStrings class.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <iterator>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace StringExtensions {
+
+    /**
+     * This class holds a sequence of strings packed one after another
+     * into a single buffer of characters, along with an array of the
+     * offsets in the buffer at which each string begins.  Compared with
+     * a collection of separate strings, the whole sequence takes only
+     * two allocations, and stepping through it reads memory in order.
+     *
+     * Offsets are 32 bits wide, so the strings together
+     * must be shorter than 4 GiB.
+     */
+    class PackedStrings {
+        // Types
+    public:
+        /**
+         * This is the type of iterator used to step through the strings.
+         */
+        class Iterator {
+            // Types
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using iterator_concept = std::forward_iterator_tag;
+            using value_type = std::string_view;
+            using difference_type = ptrdiff_t;
+            using pointer = const std::string_view*;
+            using reference = std::string_view;
+
+            // Public methods
+        public:
+            /**
+             * This constructs an iterator which isn't positioned
+             * in any sequence.
+             */
+            Iterator() = default;
+
+            /**
+             * This constructs an iterator positioned at the string
+             * with the given index in the given sequence.
+             *
+             * @param[in] strings
+             *     This is the sequence of strings.
+             *
+             * @param[in] index
+             *     This is the index of the string at which to
+             *     position the iterator.
+             */
+            Iterator(
+                const PackedStrings* strings,
+                size_t index
+            )
+                : strings_(strings)
+                , index_(index)
+            {
+            }
+
+            /**
+             * This returns the string at which the iterator is positioned.
+             */
+            std::string_view operator*() const {
+                return (*strings_)[index_];
+            }
+
+            /**
+             * This advances the iterator to the next string.
+             */
+            Iterator& operator++() {
+                ++index_;
+                return *this;
+            }
+
+            /**
+             * This advances the iterator to the next string,
+             * returning a copy of the iterator from before
+             * it was advanced.
+             */
+            Iterator operator++(int) {
+                auto previous = *this;
+                ++index_;
+                return previous;
+            }
+
+            /**
+             * This determines whether or not two iterators
+             * are positioned at the same string.
+             */
+            bool operator==(const Iterator& other) const {
+                return (
+                    (strings_ == other.strings_)
+                    && (index_ == other.index_)
+                );
+            }
+
+            /**
+             * This determines whether or not two iterators
+             * are positioned at different strings.
+             */
+            bool operator!=(const Iterator& other) const {
+                return !(*this == other);
+            }
+
+            // Private properties
+        private:
+            /**
+             * This is the sequence of strings.
+             */
+            const PackedStrings* strings_ = nullptr;
+
+            /**
+             * This is the index of the string at which
+             * the iterator is positioned.
+             */
+            size_t index_ = 0;
+        };
+
+        // Public methods
+    public:
+        /**
+         * This method reserves memory for the given number of strings
+         * having the given total length, so that appending them won't
+         * allocate any more memory.
+         *
+         * @param[in] numStrings
+         *     This is the number of strings for which to reserve memory.
+         *
+         * @param[in] totalLength
+         *     This is the total length of the strings for which
+         *     to reserve memory.
+         */
+        void Reserve(
+            size_t numStrings,
+            size_t totalLength
+        ) {
+            offsets_.reserve(numStrings + 1);
+            buffer_.reserve(totalLength);
+        }
+
+        /**
+         * This method adds a copy of the given string to the end
+         * of the sequence.
+         *
+         * @param[in] s
+         *     This is the string to add.
+         *
+         * @return
+         *     An indication of whether or not the string was added is
+         *     returned.  It isn't added if the total length of the strings
+         *     would be too long for their offsets to fit in 32 bits, in
+         *     which case the sequence is marked as truncated, and no more
+         *     strings are added until it's cleared.
+         */
+        bool Append(std::string_view s) {
+            if (
+                truncated_
+                || (s.length() > UINT32_MAX - buffer_.length())
+            ) {
+                truncated_ = true;
+                return false;
+            }
+            if (offsets_.empty()) {
+                offsets_.push_back(0);
+            }
+            buffer_.append(s);
+            offsets_.push_back((uint32_t)buffer_.length());
+            return true;
+        }
+
+        /**
+         * This method removes all the strings from the sequence,
+         * keeping the memory allocated for them, and clears the
+         * indication that the sequence is truncated.
+         */
+        void Clear() {
+            offsets_.clear();
+            buffer_.clear();
+            truncated_ = false;
+        }
+
+        /**
+         * This method indicates whether or not any string was left out
+         * of the sequence because the strings together would have been
+         * too long.
+         *
+         * @return
+         *     An indication of whether or not the sequence
+         *     is truncated is returned.
+         */
+        bool IsTruncated() const {
+            return truncated_;
+        }
+
+        /**
+         * This method returns the number of strings in the sequence.
+         *
+         * @return
+         *     The number of strings in the sequence is returned.
+         */
+        size_t GetSize() const {
+            return (offsets_.empty() ? 0 : offsets_.size() - 1);
+        }
+
+        /**
+         * This method indicates whether or not the sequence is empty.
+         *
+         * @return
+         *     An indication of whether or not the sequence
+         *     is empty is returned.
+         */
+        bool IsEmpty() const {
+            return (GetSize() == 0);
+        }
+
+        /**
+         * This method returns the buffer into which the strings
+         * are packed.
+         *
+         * @return
+         *     A view of the buffer into which the strings
+         *     are packed is returned.
+         */
+        std::string_view GetBuffer() const {
+            return buffer_;
+        }
+
+        /**
+         * This returns the string at the given index in the sequence,
+         * which must be less than the number of strings.
+         *
+         * @param[in] index
+         *     This is the index of the string to return.
+         *
+         * @return
+         *     A view of the string at the given index is returned.
+         */
+        std::string_view operator[](size_t index) const {
+            const auto begin = offsets_[index];
+            return std::string_view(
+                buffer_.data() + begin,
+                offsets_[index + 1] - begin
+            );
+        }
+
+        /**
+         * This returns an iterator positioned at the first string.
+         */
+        Iterator begin() const {
+            return Iterator(this, 0);
+        }
+
+        /**
+         * This returns an iterator positioned past the last string.
+         */
+        Iterator end() const {
+            return Iterator(this, GetSize());
+        }
+
+        // Private properties
+    private:
+        /**
+         * This holds the characters of the strings, one after another.
+         */
+        std::string buffer_;
+
+        /**
+         * These are the offsets in the buffer at which each string
+         * begins, followed by the offset just past the last string.
+         * If there are no strings, this is empty.
+         */
+        std::vector< uint32_t > offsets_;
+
+        /**
+         * This indicates whether or not any string was left out of
+         * the sequence because the strings together would have been
+         * too long.
+         */
+        bool truncated_ = false;
+    };
+
+}
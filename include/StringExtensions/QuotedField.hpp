@@ -0,0 +1,107 @@
+#pragma once
+
+/**
+ * @file QuotedField.hpp
+ *
+ * This module declares the StringExtensions::QuotedField class.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <string>
+#include <string_view>
+
+namespace StringExtensions {
+
+    /**
+     * This class represents one field of a record split by SplitQuoted.
+     * It views the text of the field in the original record, so the
+     * record must outlive it.  Quoted fields are only unescaped when
+     * their values are requested.
+     */
+    class QuotedField {
+        // Public methods
+    public:
+        /**
+         * This constructs an empty, unquoted field.
+         */
+        QuotedField() = default;
+
+        /**
+         * This constructs a field with the given text.
+         *
+         * @param[in] text
+         *     This is the text of the field, without any enclosing quotes.
+         *
+         * @param[in] quoted
+         *     This indicates whether or not the field was enclosed
+         *     in quotes.
+         *
+         * @param[in] quote
+         *     This is the quote character, which is escaped within
+         *     a quoted field by doubling it.
+         */
+        QuotedField(
+            std::string_view text,
+            bool quoted,
+            char quote = '"'
+        )
+            : text_(text)
+            , quoted_(quoted)
+            , quote_(quote)
+        {
+        }
+
+        /**
+         * This method returns the text of the field, as it appears in
+         * the record, without any enclosing quotes.  Quote characters
+         * within a quoted field are still doubled.
+         *
+         * @return
+         *     A view of the text of the field is returned.
+         */
+        std::string_view GetText() const {
+            return text_;
+        }
+
+        /**
+         * This method indicates whether or not the field was enclosed
+         * in quotes.
+         *
+         * @return
+         *     An indication of whether or not the field was enclosed
+         *     in quotes is returned.
+         */
+        bool IsQuoted() const {
+            return quoted_;
+        }
+
+        /**
+         * This method returns the value of the field, which is its
+         * text with any doubled quote characters of a quoted field
+         * replaced by single ones.
+         *
+         * @return
+         *     The value of the field is returned.
+         */
+        std::string GetValue() const;
+
+        // Private properties
+    private:
+        /**
+         * This is the text of the field, without any enclosing quotes.
+         */
+        std::string_view text_;
+
+        /**
+         * This indicates whether or not the field was enclosed in quotes.
+         */
+        bool quoted_ = false;
+
+        /**
+         * This is the quote character.
+         */
+        char quote_ = '"';
+    };
+
+}
@@ -0,0 +1,123 @@
+#pragma once
+
+/**
+ * @file Searcher.hpp
+ *
+ * This module declares the StringExtensions::Searcher class.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <stddef.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace StringExtensions {
+
+    /**
+     * This class finds instances of a given substring (the "needle")
+     * within other strings.  Any preparation needed to search for the
+     * needle is done once, when the searcher is constructed, so the
+     * searcher should be reused when searching for the same needle
+     * many times.
+     *
+     * The algorithm used depends on the length of the needle.
+     * Single bytes are found with memchr.  Short needles are found by
+     * scanning many bytes at a time for places where both the first and
+     * last bytes of the needle match, and then comparing the bytes in
+     * between.  That takes time proportional to the length of the needle
+     * at every place where its first and last bytes match, so long
+     * needles are instead found with the Two-Way algorithm, which takes
+     * time proportional to the length of the haystack however the needle
+     * and haystack are made up.  Like the Boyer-Moore-Horspool algorithm,
+     * it also skips ahead by up to the length of the needle at a time
+     * when the byte aligned with the end of the needle doesn't match.
+     */
+    class Searcher {
+        // Public methods
+    public:
+        /**
+         * This is the length from which a needle is considered "long".
+         */
+        static constexpr size_t LONG_NEEDLE_LENGTH = 32;
+
+        /**
+         * This constructs a searcher for the given needle.
+         *
+         * @param[in] needle
+         *     This is the substring to search for.  A copy is made,
+         *     so it need not outlive the searcher.
+         */
+        explicit Searcher(std::string_view needle);
+
+        /**
+         * This method returns the substring for which
+         * the searcher searches.
+         *
+         * @return
+         *     The substring for which the searcher searches is returned.
+         */
+        std::string_view GetNeedle() const {
+            return needle_;
+        }
+
+        /**
+         * This method finds the first instance of the needle in the
+         * given string, at or after the given position.
+         *
+         * @param[in] haystack
+         *     This is the string to search.
+         *
+         * @param[in] position
+         *     This is the position at which to start searching.
+         *
+         * @return
+         *     The position of the first instance of the needle found
+         *     is returned.  If the needle is not found,
+         *     std::string_view::npos is returned.  As with
+         *     std::string_view::find, an empty needle is found
+         *     at the starting position, if it is within the haystack.
+         */
+        size_t Find(std::string_view haystack, size_t position = 0) const;
+
+        // Private properties
+    private:
+        /**
+         * This is the substring for which the searcher searches.
+         */
+        std::string needle_;
+
+        /**
+         * This holds, for each possible byte value, one more than the
+         * position of the last instance of that byte in a long needle,
+         * or zero if the byte isn't in the needle.  It's used to work
+         * out how far to skip ahead when the byte aligned with the
+         * end of the needle doesn't match.  It is only made for
+         * long needles.
+         */
+        std::vector< size_t > shift_;
+
+        /**
+         * This is the position in a long needle at which it is split
+         * into halves (the "critical factorization") for the
+         * Two-Way algorithm.  The right half starts just after it.
+         */
+        size_t split_ = 0;
+
+        /**
+         * This is how far the Two-Way algorithm moves ahead after
+         * the right half of a long needle matches but the left half
+         * doesn't.  For a periodic needle, this is its period.
+         */
+        size_t period_ = 0;
+
+        /**
+         * This is the number of bytes at the start of a periodic long
+         * needle which are known to match after moving ahead by
+         * the period, or zero if the needle isn't periodic.
+         */
+        size_t periodicMemory_ = 0;
+    };
+
+}
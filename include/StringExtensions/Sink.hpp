@@ -0,0 +1,133 @@
+#pragma once
+
+/**
+ * @file Sink.hpp
+ *
+ * This module declares the StringExtensions::Sink type and
+ * related helpers, used by functions and classes of the library
+ * which deliver their output piece by piece.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <algorithm>
+#include <functional>
+#include <ostream>
+#include <stddef.h>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace StringExtensions {
+
+    /**
+     * This is the type of function which receives output piece by piece.
+     * The data given to the function is only valid for the duration
+     * of the call.
+     */
+    using Sink = std::function< void(std::string_view data) >;
+
+    /**
+     * This function returns a sink which writes all
+     * data it receives to the given stream.
+     *
+     * @param[in] stream
+     *     This is the stream to which to write data.
+     *     It must outlive the returned sink.
+     *
+     * @return
+     *     The sink is returned.
+     */
+    Sink MakeStreamSink(std::ostream& stream);
+
+    /**
+     * This class is a sink which collects data in a fixed-size buffer,
+     * handing the buffer to a "flush" sink whenever it fills up,
+     * so that many small writes become fewer, larger ones.
+     *
+     * The buffer is also handed off when the Flush method is called,
+     * which must be done once all data has been written.
+     */
+    class BufferedSink {
+        // Public methods
+    public:
+        /**
+         * This constructs a sink with a buffer of the given size.
+         *
+         * @param[in] bufferSize
+         *     This is the number of bytes the buffer can hold.
+         *     It must not be zero.
+         *
+         * @param[in] flush
+         *     This is the sink to which to hand off the contents
+         *     of the buffer whenever it is flushed.
+         */
+        BufferedSink(size_t bufferSize, Sink flush)
+            : buffer_(bufferSize)
+            , flush_(std::move(flush))
+        {
+        }
+
+        /**
+         * This method adds the given data to the buffer, flushing the
+         * buffer as needed.  Data too big to fit in the buffer is handed
+         * to the flush sink directly after anything already buffered.
+         *
+         * @param[in] data
+         *     This is the data to write.
+         */
+        void Write(std::string_view data) {
+            if (data.length() > buffer_.size() - used_) {
+                Flush();
+                if (data.length() >= buffer_.size()) {
+                    flush_(data);
+                    return;
+                }
+            }
+            std::copy(data.begin(), data.end(), buffer_.begin() + used_);
+            used_ += data.length();
+        }
+
+        /**
+         * This is a shorthand for the Write method, which lets
+         * the instance be used wherever a Sink is expected
+         * (for example, by wrapping it with std::ref).
+         *
+         * @param[in] data
+         *     This is the data to write.
+         */
+        void operator()(std::string_view data) {
+            Write(data);
+        }
+
+        /**
+         * This method hands off any data held in the buffer
+         * to the flush sink, and empties the buffer.
+         */
+        void Flush() {
+            if (used_ > 0) {
+                flush_(std::string_view(buffer_.data(), used_));
+                used_ = 0;
+            }
+        }
+
+        // Private properties
+    private:
+        /**
+         * This is where data is collected before being flushed.
+         */
+        std::vector< char > buffer_;
+
+        /**
+         * This is the number of bytes currently held in the buffer.
+         */
+        size_t used_ = 0;
+
+        /**
+         * This is the sink to which to hand off the contents
+         * of the buffer whenever it is flushed.
+         */
+        Sink flush_;
+    };
+
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+/**
+ * @file SplitN.hpp
+ *
+ * This module declares the StringExtensions::SplitN function template
+ * and the StringExtensions::SplitNResult template it returns.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <array>
+#include <stddef.h>
+#include <string_view>
+#include <StringExtensions/SplitPolicy.hpp>
+
+namespace StringExtensions {
+
+    /**
+     * This holds the result of splitting a string into
+     * at most a fixed number of pieces.
+     *
+     * @param[in] N
+     *     This is the most pieces the result can hold.
+     */
+    template< size_t N > struct SplitNResult {
+        /**
+         * These are views of the pieces found.  Any pieces
+         * past the number found are empty.
+         */
+        std::array< std::string_view, N > pieces{};
+
+        /**
+         * This is the number of pieces found.
+         */
+        size_t count = 0;
+
+        /**
+         * This indicates whether or not the string had more pieces
+         * than the result can hold.
+         */
+        bool overflow = false;
+    };
+
+    /**
+     * This function breaks the given string at each instance of the
+     * given delimiter, according to the given policy, returning views
+     * of up to the given number of pieces, without allocating memory.
+     * The string is no longer scanned once there are too many pieces.
+     * The split can be done at compile time.
+     *
+     * @param[in] N
+     *     This is the most pieces to return.
+     *
+     * @param[in] Policy
+     *     This is the policy for splitting the string.  Its MaxSplits
+     *     setting is not used.
+     *
+     * @param[in] s
+     *     This is the string to split.  It must outlive the
+     *     returned pieces.
+     *
+     * @param[in] d
+     *     This is the delimiter character at which to split the string.
+     *
+     * @return
+     *     Views of the pieces found, along with the number of pieces,
+     *     and whether or not there were too many, are returned.
+     */
+    template< size_t N, typename Policy = SplitPolicy<> > constexpr SplitNResult< N > SplitN(
+        std::string_view s,
+        char d
+    ) {
+        // The pieces emitted are counted, rather than limiting the
+        // number of splits, since empty pieces may be dropped.  Once a
+        // piece beyond the first N is seen, no more delimiters are
+        // looked for, and whatever remains is ignored.
+        using UnlimitedPolicy = SplitPolicy< Policy::trimPieces, Policy::emptyPieces >;
+        SplitNResult< N > result;
+        SplitWithPolicy< UnlimitedPolicy >(
+            s,
+            [d, &result](std::string_view remainder, size_t& delimiterLength){
+                delimiterLength = 1;
+                if (result.overflow) {
+                    return std::string_view::npos;
+                }
+                return remainder.find(d);
+            },
+            [&result](std::string_view piece){
+                if (result.count < N) {
+                    result.pieces[result.count++] = piece;
+                } else {
+                    result.overflow = true;
+                }
+            }
+        );
+        return result;
+    }
+
+}
@@ -0,0 +1,284 @@
+#pragma once
+
+/**
+ * @file SplitPolicy.hpp
+ *
+ * This module declares the StringExtensions::SplitPolicy template and
+ * the versions of the Split and SplitView functions which follow a
+ * split policy chosen at compile time.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <stddef.h>
+#include <string>
+#include <string_view>
+#include <StringExtensions/Searcher.hpp>
+#include <StringExtensions/Trim.hpp>
+#include <vector>
+
+namespace StringExtensions {
+
+    /**
+     * These are the ways a split can treat pieces which are empty
+     * (after trimming, if the pieces are trimmed).
+     */
+    enum class EmptyPieces {
+        /**
+         * Empty pieces are kept, except for the last piece, which is
+         * dropped if it's empty.  This is what Split does.
+         */
+        DropLast,
+
+        /**
+         * Empty pieces are kept, so there is always one more piece
+         * than the number of delimiters found.
+         */
+        Keep,
+
+        /**
+         * Empty pieces are dropped.
+         */
+        Drop,
+    };
+
+    /**
+     * This template describes how a string is split, for use with the
+     * Split and SplitView function templates.  The default policy
+     * splits in the same way as the Split function.
+     *
+     * @param[in] TrimPieces
+     *     This indicates whether or not whitespace is trimmed from the
+     *     string and each piece.  When it is, any whitespace following
+     *     a delimiter is skipped, including further delimiters which
+     *     are whitespace.
+     *
+     * @param[in] EmptyPiecesTreatment
+     *     This selects which of the empty pieces are kept.
+     *
+     * @param[in] MaxSplits
+     *     If not zero, this is the most times to split the string,
+     *     with the rest of the string after the last split becoming
+     *     the last piece.
+     */
+    template<
+        bool TrimPieces = true,
+        EmptyPieces EmptyPiecesTreatment = EmptyPieces::DropLast,
+        size_t MaxSplits = 0
+    > struct SplitPolicy {
+        static constexpr bool trimPieces = TrimPieces;
+        static constexpr EmptyPieces emptyPieces = EmptyPiecesTreatment;
+        static constexpr size_t maxSplits = MaxSplits;
+    };
+
+    /**
+     * This is the policy for splitting data which is already clean:
+     * nothing is trimmed, and every piece is kept, even if empty.
+     */
+    using RawSplitPolicy = SplitPolicy< false, EmptyPieces::Keep >;
+
+    /**
+     * This function breaks the given string into pieces according
+     * to the given policy, handing each piece to the given function
+     * as a view into the string.  Everything the policy doesn't call
+     * for is left out at compile time, and if the functions given
+     * can be evaluated at compile time, so can the split.
+     *
+     * @param[in] s
+     *     This is the string to split.
+     *
+     * @param[in] findDelimiter
+     *     This is the function to call to find the next delimiter.
+     *     It is given the rest of the string to scan and a reference
+     *     through which to store the length of the delimiter found,
+     *     and it returns the position of the delimiter, or
+     *     std::string_view::npos if there is none.
+     *
+     * @param[in] emit
+     *     This is the function to call with each piece.
+     */
+    template< typename Policy, typename FindDelimiter, typename Emit > constexpr void SplitWithPolicy(
+        std::string_view s,
+        FindDelimiter&& findDelimiter,
+        Emit&& emit
+    ) {
+        auto remainder = s;
+        if constexpr (Policy::trimPieces) {
+            remainder = TrimView(remainder);
+        }
+        size_t numSplits = 0;
+        for (;;) {
+            size_t delimiterLength = 0;
+            auto delimiter = std::string_view::npos;
+            if (
+                (Policy::maxSplits == 0)
+                || (numSplits < Policy::maxSplits)
+            ) {
+                delimiter = findDelimiter(remainder, delimiterLength);
+            }
+            if (delimiter == std::string_view::npos) {
+                if (
+                    (Policy::emptyPieces == EmptyPieces::Keep)
+                    || !remainder.empty()
+                ) {
+                    emit(remainder);
+                }
+                return;
+            }
+            auto piece = remainder.substr(0, delimiter);
+            if constexpr (Policy::trimPieces) {
+                piece = TrimBackView(piece);
+            }
+            if (
+                (Policy::emptyPieces != EmptyPieces::Drop)
+                || !piece.empty()
+            ) {
+                emit(piece);
+            }
+            remainder = remainder.substr(delimiter + delimiterLength);
+            if constexpr (Policy::trimPieces) {
+                remainder = TrimFrontView(remainder);
+            }
+            ++numSplits;
+        }
+    }
+
+    /**
+     * This function breaks the given string at each instance of the
+     * given delimiter, according to the given policy, returning the
+     * pieces as a collection of substrings.
+     *
+     * @param[in] s
+     *     This is the string to split.
+     *
+     * @param[in] d
+     *     This is the delimiter character at which to split the string.
+     *
+     * @return
+     *     The collection of substrings that result from breaking the given
+     *     string at each delimiter character is returned.
+     */
+    template< typename Policy > std::vector< std::string > Split(
+        std::string_view s,
+        char d
+    ) {
+        std::vector< std::string > values;
+        SplitWithPolicy< Policy >(
+            s,
+            [d](std::string_view remainder, size_t& delimiterLength){
+                delimiterLength = 1;
+                return remainder.find(d);
+            },
+            [&values](std::string_view piece){ values.emplace_back(piece); }
+        );
+        return values;
+    }
+
+    /**
+     * This function breaks the given string at each instance of the
+     * given delimiter, according to the given policy, returning the
+     * pieces as a collection of substrings.
+     *
+     * @param[in] s
+     *     This is the string to split.
+     *
+     * @param[in] d
+     *     This is the delimiter substring at which to split the string.
+     *     If it is empty, the string is not split.
+     *
+     * @return
+     *     The collection of substrings that result from breaking the given
+     *     string at each delimiter substring is returned.
+     */
+    template< typename Policy > std::vector< std::string > Split(
+        std::string_view s,
+        std::string_view d
+    ) {
+        std::vector< std::string > values;
+        const Searcher searcher(d);
+        SplitWithPolicy< Policy >(
+            s,
+            [&searcher](std::string_view remainder, size_t& delimiterLength){
+                delimiterLength = searcher.GetNeedle().length();
+                if (delimiterLength == 0) {
+                    return std::string_view::npos;
+                }
+                return searcher.Find(remainder);
+            },
+            [&values](std::string_view piece){ values.emplace_back(piece); }
+        );
+        return values;
+    }
+
+    /**
+     * This function breaks the given string at each instance of the
+     * given delimiter, according to the given policy, returning the
+     * pieces as views into the given string.
+     *
+     * @param[in] s
+     *     This is the string to split.  It must outlive the
+     *     returned pieces.
+     *
+     * @param[in] d
+     *     This is the delimiter character at which to split the string.
+     *
+     * @return
+     *     The collection of views of the substrings that result from
+     *     breaking the given string at each delimiter character
+     *     is returned.
+     */
+    template< typename Policy > std::vector< std::string_view > SplitView(
+        std::string_view s,
+        char d
+    ) {
+        std::vector< std::string_view > values;
+        SplitWithPolicy< Policy >(
+            s,
+            [d](std::string_view remainder, size_t& delimiterLength){
+                delimiterLength = 1;
+                return remainder.find(d);
+            },
+            [&values](std::string_view piece){ values.push_back(piece); }
+        );
+        return values;
+    }
+
+    /**
+     * This function breaks the given string at each instance of the
+     * given delimiter, according to the given policy, returning the
+     * pieces as views into the given string.
+     *
+     * @param[in] s
+     *     This is the string to split.  It must outlive the
+     *     returned pieces.
+     *
+     * @param[in] d
+     *     This is the delimiter substring at which to split the string.
+     *     If it is empty, the string is not split.
+     *
+     * @return
+     *     The collection of views of the substrings that result from
+     *     breaking the given string at each delimiter substring
+     *     is returned.
+     */
+    template< typename Policy > std::vector< std::string_view > SplitView(
+        std::string_view s,
+        std::string_view d
+    ) {
+        std::vector< std::string_view > values;
+        const Searcher searcher(d);
+        SplitWithPolicy< Policy >(
+            s,
+            [&searcher](std::string_view remainder, size_t& delimiterLength){
+                delimiterLength = searcher.GetNeedle().length();
+                if (delimiterLength == 0) {
+                    return std::string_view::npos;
+                }
+                return searcher.Find(remainder);
+            },
+            [&values](std::string_view piece){ values.push_back(piece); }
+        );
+        return values;
+    }
+
+}
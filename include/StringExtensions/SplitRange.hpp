@@ -0,0 +1,295 @@
+#pragma once
+
+/**
+ * @file SplitRange.hpp
+ *
+ * This module declares the StringExtensions::SplitRange class.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <iterator>
+#include <stddef.h>
+#include <string_view>
+
+#if __has_include(<version>)
+#include <version>
+#endif
+#if defined(__cpp_lib_ranges)
+#include <ranges>
+#endif
+
+namespace StringExtensions {
+
+    /**
+     * This class is a lazily evaluated range of the pieces of a string
+     * broken at each instance of a delimiter, with the same trimming
+     * semantics as the Split function.  Each piece is a view into the
+     * original string, which must outlive the range and its iterators.
+     *
+     * No delimiter is searched for until an iterator is incremented,
+     * so stopping early doesn't scan the rest of the string, and
+     * iterating never allocates memory.
+     */
+    class SplitRange {
+        // Types
+    public:
+        /**
+         * This is the type of iterator used to step through
+         * the pieces of the string.
+         */
+        class Iterator {
+            // Types
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using iterator_concept = std::forward_iterator_tag;
+            using value_type = std::string_view;
+            using difference_type = ptrdiff_t;
+            using pointer = const std::string_view*;
+            using reference = std::string_view;
+
+            // Public methods
+        public:
+            /**
+             * This constructs an iterator which is past the end
+             * of every range.
+             */
+            Iterator() = default;
+
+            /**
+             * This returns the piece at which the iterator is positioned.
+             */
+            std::string_view operator*() const {
+                return piece_;
+            }
+
+            /**
+             * This returns a pointer to the piece at which the
+             * iterator is positioned.
+             */
+            const std::string_view* operator->() const {
+                return &piece_;
+            }
+
+            /**
+             * This advances the iterator to the next piece.
+             */
+            Iterator& operator++() {
+                Advance();
+                return *this;
+            }
+
+            /**
+             * This advances the iterator to the next piece,
+             * returning a copy of the iterator from before
+             * it was advanced.
+             */
+            Iterator operator++(int) {
+                auto previous = *this;
+                Advance();
+                return previous;
+            }
+
+            /**
+             * This determines whether or not two iterators
+             * are positioned at the same piece.
+             */
+            bool operator==(const Iterator& other) const {
+                return (
+                    (atEnd_ == other.atEnd_)
+                    && (
+                        atEnd_
+                        || (
+                            (piece_.data() == other.piece_.data())
+                            && (remainder_.data() == other.remainder_.data())
+                        )
+                    )
+                );
+            }
+
+            /**
+             * This determines whether or not two iterators
+             * are positioned at different pieces.
+             */
+            bool operator!=(const Iterator& other) const {
+                return !(*this == other);
+            }
+
+            // Private methods
+        private:
+            friend class SplitRange;
+
+            /**
+             * This constructs an iterator positioned at the
+             * first piece of the given string.
+             *
+             * @param[in] s
+             *     This is the string to split.
+             *
+             * @param[in] delimiter
+             *     This is the delimiter substring at which to split the
+             *     string, if the string is split at a substring.
+             *
+             * @param[in] delimiterCharacter
+             *     This is the delimiter character at which to split the
+             *     string, if the string is split at a character.
+             *
+             * @param[in] substringDelimiter
+             *     This indicates whether the string is split at a
+             *     delimiter substring rather than a delimiter character.
+             */
+            Iterator(
+                std::string_view s,
+                std::string_view delimiter,
+                char delimiterCharacter,
+                bool substringDelimiter
+            );
+
+            /**
+             * This method moves the iterator to the next piece, finding
+             * the delimiter which ends it, or moves the iterator past
+             * the end if there are no more pieces.
+             */
+            void Advance();
+
+            // Private properties
+        private:
+            /**
+             * This is the piece at which the iterator is positioned.
+             */
+            std::string_view piece_;
+
+            /**
+             * This is the rest of the string after the current piece
+             * and the delimiter which follows it.
+             */
+            std::string_view remainder_;
+
+            /**
+             * This is the delimiter substring at which to split the
+             * string, if the string is split at a substring.
+             */
+            std::string_view delimiter_;
+
+            /**
+             * This is the delimiter character at which to split the
+             * string, if the string is split at a character.
+             */
+            char delimiterCharacter_ = 0;
+
+            /**
+             * This indicates whether the string is split at a delimiter
+             * substring rather than a delimiter character.
+             */
+            bool substringDelimiter_ = false;
+
+            /**
+             * This indicates whether or not the iterator is
+             * past the last piece.
+             */
+            bool atEnd_ = true;
+        };
+
+        // Public methods
+    public:
+        /**
+         * This constructs a range of the pieces of the given string
+         * broken at each instance of the given delimiter character.
+         *
+         * @param[in] s
+         *     This is the string to split.  It must outlive the range
+         *     and its iterators.
+         *
+         * @param[in] d
+         *     This is the delimiter character at which to split the string.
+         */
+        SplitRange(std::string_view s, char d)
+            : s_(s)
+            , delimiterCharacter_(d)
+        {
+        }
+
+        /**
+         * This constructs a range of the pieces of the given string
+         * broken at each instance of the given delimiter substring.
+         *
+         * @param[in] s
+         *     This is the string to split.  It must outlive the range
+         *     and its iterators.
+         *
+         * @param[in] d
+         *     This is the delimiter substring at which to split the
+         *     string.  It must outlive the range and its iterators.
+         *     If it is empty, the string is not split.
+         */
+        SplitRange(std::string_view s, std::string_view d)
+            : s_(s)
+            , delimiter_(d)
+            , substringDelimiter_(true)
+        {
+        }
+
+        /**
+         * This method returns an iterator positioned at the first
+         * piece of the string.
+         *
+         * @return
+         *     An iterator positioned at the first piece of the
+         *     string is returned.
+         */
+        Iterator begin() const {
+            return Iterator(
+                s_,
+                delimiter_,
+                delimiterCharacter_,
+                substringDelimiter_
+            );
+        }
+
+        /**
+         * This method returns an iterator positioned past the
+         * last piece of the string.
+         *
+         * @return
+         *     An iterator positioned past the last piece of the
+         *     string is returned.
+         */
+        Iterator end() const {
+            return Iterator();
+        }
+
+        // Private properties
+    private:
+        /**
+         * This is the string to split.
+         */
+        std::string_view s_;
+
+        /**
+         * This is the delimiter substring at which to split the string,
+         * if the string is split at a substring.
+         */
+        std::string_view delimiter_;
+
+        /**
+         * This is the delimiter character at which to split the string,
+         * if the string is split at a character.
+         */
+        char delimiterCharacter_ = 0;
+
+        /**
+         * This indicates whether the string is split at a delimiter
+         * substring rather than a delimiter character.
+         */
+        bool substringDelimiter_ = false;
+    };
+
+}
+
+#if defined(__cpp_lib_ranges)
+/**
+ * Iterators of a SplitRange refer only to the string being split,
+ * not to the range itself, so they may outlive the range.
+ */
+template<> inline constexpr bool std::ranges::enable_borrowed_range< StringExtensions::SplitRange > = true;
+#endif
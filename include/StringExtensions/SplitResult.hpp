@@ -0,0 +1,170 @@
+#pragma once
+
+/**
+ * @file SplitResult.hpp
+ *
+ * This module declares the StringExtensions::SplitResult class.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <stddef.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace StringExtensions {
+
+    /**
+     * This class holds the result of splitting a string which has been
+     * moved into it.  The pieces are views into the string held by the
+     * instance, so nothing is copied, and the pieces remain valid for
+     * as long as the instance does, wherever it's copied or moved.
+     */
+    class SplitResult {
+        // Types
+    public:
+        /**
+         * This is the type of iterator used to step through the pieces.
+         */
+        using Iterator = std::vector< std::string_view >::const_iterator;
+
+        // Lifecycle management
+    public:
+        ~SplitResult() noexcept = default;
+        SplitResult(const SplitResult& other);
+        SplitResult(SplitResult&& other) noexcept;
+        SplitResult& operator=(const SplitResult& other);
+        SplitResult& operator=(SplitResult&& other) noexcept;
+
+        // Public methods
+    public:
+        /**
+         * This constructs an empty result.
+         */
+        SplitResult() = default;
+
+        /**
+         * This constructs the result of breaking the given string at
+         * each instance of the given delimiter, in the same way as Split.
+         *
+         * @param[in] s
+         *     This is the string to split, which the instance takes.
+         *
+         * @param[in] d
+         *     This is the delimiter character at which to split the string.
+         */
+        SplitResult(
+            std::string&& s,
+            char d
+        );
+
+        /**
+         * This constructs the result of breaking the given string at
+         * each instance of the given delimiter, in the same way as Split.
+         *
+         * @param[in] s
+         *     This is the string to split, which the instance takes.
+         *
+         * @param[in] d
+         *     This is the delimiter substring at which to split the string.
+         *     If it is empty, the string is not split.
+         */
+        SplitResult(
+            std::string&& s,
+            std::string_view d
+        );
+
+        /**
+         * This method returns the string which was split.
+         *
+         * @return
+         *     A view of the string which was split is returned.
+         */
+        std::string_view GetBuffer() const {
+            return buffer_;
+        }
+
+        /**
+         * This method returns the pieces of the string.
+         *
+         * @return
+         *     Views of the pieces of the string are returned.
+         */
+        const std::vector< std::string_view >& GetPieces() const {
+            return pieces_;
+        }
+
+        /**
+         * This method returns the number of pieces of the string.
+         *
+         * @return
+         *     The number of pieces of the string is returned.
+         */
+        size_t GetSize() const {
+            return pieces_.size();
+        }
+
+        /**
+         * This method returns copies of the pieces of the string.
+         *
+         * @return
+         *     Copies of the pieces of the string are returned.
+         */
+        std::vector< std::string > ToStrings() const;
+
+        /**
+         * This returns the piece at the given index, which must be
+         * less than the number of pieces.
+         *
+         * @param[in] index
+         *     This is the index of the piece to return.
+         *
+         * @return
+         *     A view of the piece at the given index is returned.
+         */
+        std::string_view operator[](size_t index) const {
+            return pieces_[index];
+        }
+
+        /**
+         * This returns an iterator positioned at the first piece.
+         */
+        Iterator begin() const {
+            return pieces_.begin();
+        }
+
+        /**
+         * This returns an iterator positioned past the last piece.
+         */
+        Iterator end() const {
+            return pieces_.end();
+        }
+
+        // Private methods
+    private:
+        /**
+         * This method points the pieces back into the buffer, after the
+         * buffer has been copied or moved from one which held its
+         * characters at the given address.
+         *
+         * @param[in] previousData
+         *     This is where the characters of the buffer were held
+         *     before it was copied or moved.
+         */
+        void Rebase(const char* previousData);
+
+        // Private properties
+    private:
+        /**
+         * This is the string which was split.
+         */
+        std::string buffer_;
+
+        /**
+         * These are the pieces of the string.
+         */
+        std::vector< std::string_view > pieces_;
+    };
+
+}
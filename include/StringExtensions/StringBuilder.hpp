@@ -0,0 +1,206 @@
+#pragma once
+
+/**
+ * @file StringBuilder.hpp
+ *
+ * This module declares the StringExtensions::StringBuilder class.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <memory>
+#include <stddef.h>
+#include <string.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace StringExtensions {
+
+    /**
+     * This class builds up a string a piece at a time, in a chain of
+     * chunks of memory, each twice the size of the one before.  Unlike a
+     * std::string or std::ostringstream, when it runs out of room it
+     * starts a new chunk rather than moving what's been written so far,
+     * so every character is copied only once on the way in, and once
+     * more if the result is flattened into a single string.  The chunks
+     * may also be written out as they are, with scatter-gather output.
+     */
+    class StringBuilder {
+        // Lifecycle management
+    public:
+        ~StringBuilder() noexcept;
+        StringBuilder(const StringBuilder&) = delete;
+        StringBuilder(StringBuilder&& other) noexcept;
+        StringBuilder& operator=(const StringBuilder&) = delete;
+        StringBuilder& operator=(StringBuilder&& other) noexcept;
+
+        // Public methods
+    public:
+        /**
+         * This constructs an empty builder.  No memory is allocated
+         * until something is appended.
+         */
+        StringBuilder();
+
+        /**
+         * This method appends the given string.
+         *
+         * @param[in] s
+         *     This is the string to append.
+         */
+        void Append(std::string_view s) {
+            if (s.length() <= (size_t)(end_ - next_)) {
+                if (!s.empty()) {
+                    (void)memcpy(next_, s.data(), s.length());
+                    next_ += s.length();
+                    length_ += s.length();
+                }
+            } else {
+                AppendSlow(s);
+            }
+        }
+
+        /**
+         * This method appends the given character.
+         *
+         * @param[in] c
+         *     This is the character to append.
+         */
+        void Append(char c) {
+            if (next_ == end_) {
+                Grow(1);
+            }
+            *next_++ = c;
+            ++length_;
+        }
+
+        /**
+         * This method appends the given character the given
+         * number of times.
+         *
+         * @param[in] count
+         *     This is the number of times to append the character.
+         *
+         * @param[in] c
+         *     This is the character to append.
+         */
+        void Append(
+            size_t count,
+            char c
+        );
+
+        /**
+         * This method returns the length of the string built so far.
+         *
+         * @return
+         *     The length of the string built so far is returned.
+         */
+        size_t GetLength() const {
+            return length_;
+        }
+
+        /**
+         * This method indicates whether or not anything has been
+         * appended since the builder was made or last cleared.
+         *
+         * @return
+         *     An indication of whether or not the string built
+         *     so far is empty is returned.
+         */
+        bool IsEmpty() const {
+            return (length_ == 0);
+        }
+
+        /**
+         * This method copies the string built so far into a single
+         * string, which is allocated only once.
+         *
+         * @return
+         *     The string built so far is returned.
+         */
+        std::string ToString() const;
+
+        /**
+         * This method returns the chunks which together hold the string
+         * built so far, in order, for writing them out without first
+         * copying them into a single string.  The views remain valid
+         * until the builder is cleared or destroyed, even if more
+         * is appended in the meantime.
+         *
+         * @return
+         *     Views of the chunks holding the string built so far
+         *     are returned.  Empty chunks are left out.
+         */
+        std::vector< std::string_view > GetChunks() const;
+
+        /**
+         * This method empties the builder, keeping only its
+         * largest chunk of memory for reuse.
+         */
+        void Clear();
+
+        // Private methods
+    private:
+        /**
+         * This method appends the given string, which doesn't fit in
+         * the current chunk, filling the current chunk and starting
+         * a new one for the rest.
+         *
+         * @param[in] s
+         *     This is the string to append.
+         */
+        void AppendSlow(std::string_view s);
+
+        /**
+         * This method starts a new chunk with room for at least
+         * the given number of characters.
+         *
+         * @param[in] minimum
+         *     This is the least number of characters the new chunk
+         *     must be able to hold.
+         */
+        void Grow(size_t minimum);
+
+        // Private properties
+    private:
+        /**
+         * This is the type of structure which holds one chunk
+         * of the string.
+         */
+        struct Chunk {
+            /**
+             * This is the memory allocated for the chunk.
+             */
+            std::unique_ptr< char[] > data;
+
+            /**
+             * This is the number of characters the chunk can hold.
+             */
+            size_t capacity = 0;
+        };
+
+        /**
+         * These are the chunks holding the string, in order.
+         * Every chunk is full except the last one.
+         */
+        std::vector< Chunk > chunks_;
+
+        /**
+         * This points to where the next character appended goes
+         * in the last chunk.
+         */
+        char* next_ = nullptr;
+
+        /**
+         * This points just past the end of the last chunk.
+         */
+        char* end_ = nullptr;
+
+        /**
+         * This is the length of the string built so far.
+         */
+        size_t length_ = 0;
+    };
+
+}
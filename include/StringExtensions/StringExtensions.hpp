@@ -13,6 +13,16 @@
 #include <stdarg.h>
 #include <stdint.h>
 #include <string>
+#include <string_view>
+#include <StringExtensions/CharSet.hpp>
+#include <StringExtensions/EscapedString.hpp>
+#include <StringExtensions/Join.hpp>
+#include <StringExtensions/PackedStrings.hpp>
+#include <StringExtensions/QuotedField.hpp>
+#include <StringExtensions/SplitN.hpp>
+#include <StringExtensions/SplitPolicy.hpp>
+#include <StringExtensions/SplitResult.hpp>
+#include <StringExtensions/StringBuilder.hpp>
 #include <vector>
 
 namespace StringExtensions {
@@ -127,6 +137,71 @@ namespace StringExtensions {
      */
     std::string Escape(const std::string& s, char escapeCharacter, const std::set< char >& charactersToEscape);
 
+    /**
+     * This function returns a copy of the given input string, modified
+     * so that every character in the given "charactersToEscape" that is
+     * found in the input string is prefixed by the given "escapeCharacter".
+     *
+     * This overload takes the characters to escape as a CharSet,
+     * which can be built once (even at compile time) and reused.
+     *
+     * @param[in] s
+     *     This is the input string.
+     *
+     * @param[in] escapeCharacter
+     *     This is the character to put in front of every character
+     *     in the input string that is a member of the
+     *     "charactersToEscape" set.
+     *
+     * @param[in] charactersToEscape
+     *     These are the characters that should be escaped in the input.
+     *
+     * @return
+     *     A copy of the input string is returned, where every character
+     *     in the given "charactersToEscape" that is found in the input
+     *     string is prefixed by the given "escapeCharacter".
+     */
+    std::string Escape(const std::string& s, char escapeCharacter, const CharSet& charactersToEscape);
+
+    /**
+     * This function determines whether or not any character in the
+     * given "charactersToEscape" is found in the given input string.
+     *
+     * @param[in] s
+     *     This is the input string.
+     *
+     * @param[in] charactersToEscape
+     *     These are the characters that should be escaped in the input.
+     *
+     * @return
+     *     An indication of whether or not any character in the input
+     *     string would be escaped by Escape is returned.
+     */
+    bool NeedsEscaping(std::string_view s, const CharSet& charactersToEscape);
+
+    /**
+     * This function escapes the given input string in the same way as
+     * Escape, except that if nothing in the input string needs escaping,
+     * no copy is made, and a view of the input string is returned instead.
+     *
+     * @param[in] s
+     *     This is the input string.  If nothing in it needs escaping,
+     *     it must outlive the returned object.
+     *
+     * @param[in] escapeCharacter
+     *     This is the character to put in front of every character
+     *     in the input string that is a member of the
+     *     "charactersToEscape" set.
+     *
+     * @param[in] charactersToEscape
+     *     These are the characters that should be escaped in the input.
+     *
+     * @return
+     *     An object holding either a view of the input string or an
+     *     escaped copy of it is returned.
+     */
+    EscapedString EscapeIfNeeded(std::string_view s, char escapeCharacter, const CharSet& charactersToEscape);
+
     /**
      * This function removes the given escapeCharacter from the given
      * input string, returning the result.
@@ -143,6 +218,116 @@ namespace StringExtensions {
      */
     std::string Unescape(const std::string& s, char escapeCharacter);
 
+    /**
+     * This function removes the given escapeCharacter from the given
+     * string, in place, in the same way as Unescape.  Since the result
+     * is never longer than the input, no memory is allocated.
+     *
+     * @param[in,out] s
+     *     This is the string from which to remove all escape characters.
+     *
+     * @param[in] escapeCharacter
+     *     This is the character to remove from the given string.
+     */
+    void UnescapeInPlace(std::string& s, char escapeCharacter);
+
+    /**
+     * This function returns a copy of the given input string, escaped
+     * so that it can be placed between double quotes to form a JSON
+     * string.  Quotation marks, backslashes, and control characters
+     * are escaped, using the short forms (e.g. "\n") where JSON has
+     * them, and the "\u00XX" form otherwise.  All other characters,
+     * including those of UTF-8 multibyte sequences, are copied as-is.
+     *
+     * @param[in] s
+     *     This is the input string.
+     *
+     * @return
+     *     The escaped copy of the input string is returned.
+     */
+    std::string EscapeJson(std::string_view s);
+
+    /**
+     * This function reverses the escaping done to the contents of a
+     * JSON string (not including the surrounding double quotes),
+     * encoding any "\uXXXX" escapes (including surrogate pairs)
+     * in UTF-8.
+     *
+     * @param[in] s
+     *     This is the input string.
+     *
+     * @param[out] output
+     *     This is where to store the unescaped string.
+     *
+     * @return
+     *     An indication of whether or not the input string was
+     *     validly escaped is returned.
+     */
+    bool UnescapeJson(std::string_view s, std::string& output);
+
+    /**
+     * This function returns a copy of the given input string, escaped
+     * so that it can be placed between double quotes to form a C or C++
+     * string literal.  Quotation marks, backslashes, control characters,
+     * and bytes outside of printable ASCII are escaped, using the short
+     * forms (e.g. "\n") where C has them, and three-digit octal escapes
+     * otherwise.
+     *
+     * @param[in] s
+     *     This is the input string.
+     *
+     * @return
+     *     The escaped copy of the input string is returned.
+     */
+    std::string EscapeCLiteral(std::string_view s);
+
+    /**
+     * This function reverses the escaping done to the contents of a
+     * C or C++ string literal (not including the surrounding double
+     * quotes).  Simple, octal, and hexadecimal escapes are supported,
+     * as are universal character names ("\uXXXX" and "\UXXXXXXXX"),
+     * which are encoded in UTF-8.
+     *
+     * @param[in] s
+     *     This is the input string.
+     *
+     * @param[out] output
+     *     This is where to store the unescaped string.
+     *
+     * @return
+     *     An indication of whether or not the input string was
+     *     validly escaped is returned.
+     */
+    bool UnescapeCLiteral(std::string_view s, std::string& output);
+
+    /**
+     * This function finds the first instance of the given substring
+     * (the "needle") in the given string (the "haystack"), at or after
+     * the given position.  It gives the same results as
+     * std::string_view::find, but uses a Searcher, which is faster
+     * for longer needles and haystacks.  To search for the same needle
+     * many times, construct a Searcher once and use it instead.
+     *
+     * @param[in] haystack
+     *     This is the string to search.
+     *
+     * @param[in] needle
+     *     This is the substring to find.
+     *
+     * @param[in] position
+     *     This is the position at which to start searching.
+     *
+     * @return
+     *     The position of the first instance of the needle found
+     *     is returned.  If the needle is not found,
+     *     std::string_view::npos is returned.
+     */
+    size_t Find(
+        std::string_view haystack,
+        std::string_view needle,
+        size_t position = 0
+    );
+
     /**
      * This function breaks the given string at each instance of the
      * given delimiter, returning the pieces as a collection of substrings.
@@ -183,6 +368,336 @@ namespace StringExtensions {
         const std::string& d
     );
 
+    /**
+     * This function breaks the given string at each instance of the
+     * given delimiter, in the same way as Split, except that the pieces
+     * are returned as views into the given string rather than copies.
+     * The string is scanned only once.
+     *
+     * @param[in] s
+     *     This is the string to split.  It must outlive the
+     *     returned pieces.
+     *
+     * @param[in] d
+     *     This is the delimiter character at which to split the string.
+     *
+     * @return
+     *     The collection of views of the substrings that result from
+     *     breaking the given string at each delimiter character
+     *     is returned.
+     */
+    std::vector< std::string_view > SplitView(
+        std::string_view s,
+        char d
+    );
+
+    /**
+     * This function breaks the given string at each instance of the
+     * given delimiter, in the same way as Split, except that the pieces
+     * are returned as views into the given string rather than copies.
+     * The string is scanned only once.
+     *
+     * @param[in] s
+     *     This is the string to split.  It must outlive the
+     *     returned pieces.
+     *
+     * @param[in] d
+     *     This is the delimiter substring at which to split the string.
+     *     If it is empty, the string is not split.
+     *
+     * @return
+     *     The collection of views of the substrings that result from
+     *     breaking the given string at each delimiter substring
+     *     is returned.
+     */
+    std::vector< std::string_view > SplitView(
+        std::string_view s,
+        std::string_view d
+    );
+
+    /**
+     * This function breaks the given string at each instance of any
+     * character in the given set, returning the pieces as a collection
+     * of substrings, in the same way as Split with a single delimiter
+     * character.  Because pieces are trimmed, a run of whitespace
+     * delimiters separates two pieces only once.
+     *
+     * @param[in] s
+     *     This is the string to split.
+     *
+     * @param[in] d
+     *     This is the set of delimiter characters at which to split
+     *     the string.
+     *
+     * @return
+     *     The collection of substrings that result from breaking the given
+     *     string at each delimiter character is returned.
+     */
+    std::vector< std::string > Split(
+        const std::string& s,
+        const CharSet& d
+    );
+
+    /**
+     * This function breaks the given string at each instance of any
+     * character in the given set, in the same way as Split, except
+     * that the pieces are returned as views into the given string
+     * rather than copies.
+     *
+     * @param[in] s
+     *     This is the string to split.  It must outlive the
+     *     returned pieces.
+     *
+     * @param[in] d
+     *     This is the set of delimiter characters at which to split
+     *     the string.
+     *
+     * @return
+     *     The collection of views of the substrings that result from
+     *     breaking the given string at each delimiter character
+     *     is returned.
+     */
+    std::vector< std::string_view > SplitView(
+        std::string_view s,
+        const CharSet& d
+    );
+
+    /**
+     * This function breaks the given string at each instance of the
+     * given delimiter, in the same way as Split, storing the pieces in
+     * the given collection in place of whatever it held before.
+     *
+     * The collection's memory, and the memory of each string already
+     * in it, is reused, so that splitting one line after another into
+     * the same collection stops allocating memory once the collection
+     * and its strings are big enough.
+     *
+     * @param[in] s
+     *     This is the string to split.
+     *
+     * @param[in] d
+     *     This is the delimiter character at which to split the string.
+     *
+     * @param[in,out] values
+     *     This is where to store the substrings that result from breaking
+     *     the given string at each delimiter character.
+     */
+    void SplitInto(
+        std::string_view s,
+        char d,
+        std::vector< std::string >& values
+    );
+
+    /**
+     * This function breaks the given string at each instance of the
+     * given delimiter, in the same way as Split, storing the pieces in
+     * the given collection in place of whatever it held before.
+     *
+     * The collection's memory, and the memory of each string already
+     * in it, is reused, so that splitting one line after another into
+     * the same collection stops allocating memory once the collection
+     * and its strings are big enough.
+     *
+     * @param[in] s
+     *     This is the string to split.
+     *
+     * @param[in] d
+     *     This is the delimiter substring at which to split the string.
+     *     If it is empty, the string is not split.
+     *
+     * @param[in,out] values
+     *     This is where to store the substrings that result from breaking
+     *     the given string at each delimiter substring.
+     */
+    void SplitInto(
+        std::string_view s,
+        std::string_view d,
+        std::vector< std::string >& values
+    );
+
+    /**
+     * This function breaks the given string at each instance of the
+     * given delimiter, in the same way as SplitView, storing the pieces
+     * in the given collection in place of whatever it held before,
+     * and reusing the collection's memory.
+     *
+     * @param[in] s
+     *     This is the string to split.  It must outlive the pieces.
+     *
+     * @param[in] d
+     *     This is the delimiter character at which to split the string.
+     *
+     * @param[in,out] values
+     *     This is where to store views of the substrings that result
+     *     from breaking the given string at each delimiter character.
+     */
+    void SplitInto(
+        std::string_view s,
+        char d,
+        std::vector< std::string_view >& values
+    );
+
+    /**
+     * This function breaks the given string at each instance of the
+     * given delimiter, in the same way as SplitView, storing the pieces
+     * in the given collection in place of whatever it held before,
+     * and reusing the collection's memory.
+     *
+     * @param[in] s
+     *     This is the string to split.  It must outlive the pieces.
+     *
+     * @param[in] d
+     *     This is the delimiter substring at which to split the string.
+     *     If it is empty, the string is not split.
+     *
+     * @param[in,out] values
+     *     This is where to store views of the substrings that result
+     *     from breaking the given string at each delimiter substring.
+     */
+    void SplitInto(
+        std::string_view s,
+        std::string_view d,
+        std::vector< std::string_view >& values
+    );
+
+    /**
+     * This function breaks the given string at each instance of the
+     * given delimiter, in the same way as Split, taking the string and
+     * returning it together with views of its pieces, so that nothing
+     * is copied, and yet the pieces can't outlive the string.
+     *
+     * @param[in] s
+     *     This is the string to split, which is moved into the result.
+     *
+     * @param[in] d
+     *     This is the delimiter character at which to split the string.
+     *
+     * @return
+     *     The string, along with views of the substrings that result
+     *     from breaking it at each delimiter character, is returned.
+     */
+    SplitResult SplitOwning(
+        std::string&& s,
+        char d
+    );
+
+    /**
+     * This function breaks the given string at each instance of the
+     * given delimiter, in the same way as Split, taking the string and
+     * returning it together with views of its pieces, so that nothing
+     * is copied, and yet the pieces can't outlive the string.
+     *
+     * @param[in] s
+     *     This is the string to split, which is moved into the result.
+     *
+     * @param[in] d
+     *     This is the delimiter substring at which to split the string.
+     *     If it is empty, the string is not split.
+     *
+     * @return
+     *     The string, along with views of the substrings that result
+     *     from breaking it at each delimiter substring, is returned.
+     */
+    SplitResult SplitOwning(
+        std::string&& s,
+        std::string_view d
+    );
+
+    /**
+     * This function breaks the given string at each instance of the
+     * given delimiter, in the same way as Split, except that copies of
+     * the pieces are packed together into one buffer.  The delimiters
+     * are counted first, so that the result is allocated only once.
+     *
+     * @param[in] s
+     *     This is the string to split.  Pieces which would make the
+     *     result longer than 4 GiB, and any following them,
+     *     are left out, and the result is marked as truncated.
+     *
+     * @param[in] d
+     *     This is the delimiter character at which to split the string.
+     *
+     * @return
+     *     The substrings that result from breaking the given string
+     *     at each delimiter character are returned.  Their IsTruncated
+     *     method indicates whether or not any were left out.
+     */
+    PackedStrings SplitPacked(
+        std::string_view s,
+        char d
+    );
+
+    /**
+     * This function breaks the given string at each instance of the
+     * given delimiter, with the same result as SplitView, but dividing
+     * the work among several threads.  The string is partitioned just
+     * after delimiters, each partition is split by its own thread, and
+     * the pieces are gathered into one collection, in order.
+     *
+     * Strings too short to be worth dividing up are split by the
+     * calling thread alone.
+     *
+     * @param[in] s
+     *     This is the string to split.  It must outlive the
+     *     returned pieces.
+     *
+     * @param[in] d
+     *     This is the delimiter character at which to split the string.
+     *
+     * @param[in] numThreads
+     *     This is the most threads to use, including the calling thread.
+     *     If zero, the number of hardware threads is used.
+     *
+     * @return
+     *     The collection of views of the substrings that result from
+     *     breaking the given string at each delimiter character
+     *     is returned.
+     */
+    std::vector< std::string_view > SplitViewParallel(
+        std::string_view s,
+        char d,
+        size_t numThreads = 0
+    );
+
+    /**
+     * This function breaks the given record into fields at each instance
+     * of the given delimiter which is not within quotes, in the manner
+     * of a CSV (RFC 4180) record.  Unlike Split, fields are not trimmed,
+     * empty fields are kept, and the record always has one more field
+     * than it has delimiters.
+     *
+     * A field beginning with the quote character is quoted; it may
+     * contain delimiters and line breaks, and a quote character within
+     * it is escaped by doubling it.  The text of each field is a view
+     * into the record, and quoted fields are only unescaped when their
+     * values are requested.  Malformed quoting is not an error, but
+     * only the splitting of such a record is meaningful.
+     *
+     * The record is scanned 64 bytes at a time, finding the quote and
+     * delimiter characters in each block and working out which of them
+     * are within quotes from the parity of the quotes before them.
+     *
+     * @param[in] s
+     *     This is the record to split, without its line terminator.
+     *     It must outlive the returned fields.
+     *
+     * @param[in] d
+     *     This is the delimiter character at which to split the record.
+     *
+     * @param[in] quote
+     *     This is the character used to quote fields.
+     *
+     * @return
+     *     The fields that result from breaking the given record at
+     *     each delimiter character which is not within quotes
+     *     are returned.
+     */
+    std::vector< QuotedField > SplitQuoted(
+        std::string_view s,
+        char d = ',',
+        char quote = '"'
+    );
+
     /**
      * This function joins together the given sequence of smaller strings
      * into one bigger string, with each piece separated by the given
@@ -226,6 +741,8 @@ namespace StringExtensions {
     /**
      * This function takes a string and swaps all upper-case characters
      * with their lower-case equivalents, returning the result.
+     * Only ASCII letters are changed; all other characters, including
+     * those encoded in UTF-8, are copied as they are.
      *
      * @param[in] inString
      *     This is the string to be normalized.
@@ -236,6 +753,41 @@ namespace StringExtensions {
      */
     std::string ToLower(const std::string& inString);
 
+    /**
+     * This function takes a string and swaps all lower-case characters
+     * with their upper-case equivalents, returning the result.
+     * Only ASCII letters are changed; all other characters, including
+     * those encoded in UTF-8, are copied as they are.
+     *
+     * @param[in] inString
+     *     This is the string to be normalized.
+     *
+     * @return
+     *     The normalized string is returned.  All lower-case characters
+     *     are replaced with their upper-case equivalents.
+     */
+    std::string ToUpper(const std::string& inString);
+
+    /**
+     * This function swaps all upper-case characters in the given string
+     * with their lower-case equivalents, without allocating any memory.
+     * Only ASCII letters are changed.
+     *
+     * @param[in,out] s
+     *     This is the string to be normalized.
+     */
+    void ToLowerInPlace(std::string& s);
+
+    /**
+     * This function swaps all lower-case characters in the given string
+     * with their upper-case equivalents, without allocating any memory.
+     * Only ASCII letters are changed.
+     *
+     * @param[in,out] s
+     *     This is the string to be normalized.
+     */
+    void ToUpperInPlace(std::string& s);
+
     /**
      * These are the different results that can be indicated
      * when a string is parsed as an integer.
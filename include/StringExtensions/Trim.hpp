@@ -0,0 +1,89 @@
+#pragma once
+
+/**
+ * @file Trim.hpp
+ *
+ * This module declares functions used to trim whitespace
+ * from strings without copying them.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <stddef.h>
+#include <string_view>
+
+namespace StringExtensions {
+
+    /**
+     * This function determines whether or not the given character is
+     * considered whitespace by the Trim function (any control character
+     * or space).
+     *
+     * @param[in] c
+     *     This is the character to check.
+     *
+     * @return
+     *     An indication of whether or not the given character
+     *     is considered whitespace is returned.
+     */
+    constexpr bool IsTrimmable(char c) {
+        return (c <= 32);
+    }
+
+    /**
+     * This function returns a view of the given text with any
+     * whitespace removed from the front.
+     *
+     * @param[in] s
+     *     This is the text to trim.
+     *
+     * @return
+     *     A view of the trimmed text is returned.
+     */
+    constexpr std::string_view TrimFrontView(std::string_view s) {
+        size_t i = 0;
+        while (
+            (i < s.length())
+            && IsTrimmable(s[i])
+        ) {
+            ++i;
+        }
+        return s.substr(i);
+    }
+
+    /**
+     * This function returns a view of the given text with any
+     * whitespace removed from the back.
+     *
+     * @param[in] s
+     *     This is the text to trim.
+     *
+     * @return
+     *     A view of the trimmed text is returned.
+     */
+    constexpr std::string_view TrimBackView(std::string_view s) {
+        size_t j = s.length();
+        while (
+            (j > 0)
+            && IsTrimmable(s[j - 1])
+        ) {
+            --j;
+        }
+        return s.substr(0, j);
+    }
+
+    /**
+     * This function returns a view of the given text with any
+     * whitespace removed from the front and back.
+     *
+     * @param[in] s
+     *     This is the text to trim.
+     *
+     * @return
+     *     A view of the trimmed text is returned.
+     */
+    constexpr std::string_view TrimView(std::string_view s) {
+        return TrimBackView(TrimFrontView(s));
+    }
+
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+/**
+ * @file Unescaper.hpp
+ *
+ * This module declares the StringExtensions::Unescaper class.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <memory>
+#include <string_view>
+#include <StringExtensions/Sink.hpp>
+
+namespace StringExtensions {
+
+    /**
+     * This class unescapes text in the same way as the Unescape function,
+     * except that the text may be given in any number of chunks, and
+     * the unescaped text is delivered to a sink as it is produced,
+     * rather than being collected into a string.
+     *
+     * An escape character at the end of one chunk applies to the
+     * first character of the next chunk.
+     */
+    class Unescaper {
+        // Lifecycle management
+    public:
+        ~Unescaper() noexcept;
+        Unescaper(const Unescaper&) = delete;
+        Unescaper(Unescaper&&) noexcept;
+        Unescaper& operator=(const Unescaper&) = delete;
+        Unescaper& operator=(Unescaper&&) noexcept;
+
+        // Public methods
+    public:
+        /**
+         * This constructs an unescaper.
+         *
+         * @param[in] escapeCharacter
+         *     This is the character to remove from the input.
+         *
+         * @param[in] sink
+         *     This is where to deliver the unescaped text.
+         */
+        Unescaper(
+            char escapeCharacter,
+            Sink sink
+        );
+
+        /**
+         * This method unescapes the given chunk of input, delivering
+         * the unescaped text to the sink.  Runs of input between escape
+         * characters are delivered without being copied.
+         *
+         * @param[in] chunk
+         *     This is the next chunk of input to unescape.
+         */
+        void Write(std::string_view chunk);
+
+        /**
+         * This method indicates whether or not the last chunk of input
+         * ended with an escape character which has not yet been applied.
+         * If the input ends here, that escape character is dropped,
+         * just as Unescape does.
+         *
+         * @return
+         *     An indication of whether or not an escape character
+         *     is pending is returned.
+         */
+        bool IsEscapePending() const;
+
+        // Private properties
+    private:
+        /**
+         * This is the type of structure that contains the private
+         * properties of the instance.  It is defined in the implementation
+         * and declared here to ensure that it is scoped inside the class.
+         */
+        struct Impl;
+
+        /**
+         * This contains the private properties of the instance.
+         */
+        std::unique_ptr< Impl > impl_;
+    };
+
+}
@@ -0,0 +1,184 @@
+#pragma once
+
+/**
+ * @file CharSetScanner.hpp
+ *
+ * This module declares the StringExtensions::CharSetScanner class,
+ * used internally by the library to find and count the characters
+ * of a string which are members of a CharSet.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include "Simd.hpp"
+#include <stddef.h>
+#include <StringExtensions/CharSet.hpp>
+
+namespace StringExtensions {
+
+    /**
+     * This class scans strings for characters which are members of a
+     * given set.  Small sets are matched sixteen bytes at a time by
+     * comparing against each member in turn; larger sets fall back to
+     * looking up each byte in the set's bitmap.
+     */
+    class CharSetScanner {
+        // Public methods
+    public:
+        /**
+         * This is the largest number of members a set may have
+         * for it to be matched using vector comparisons.
+         */
+        static constexpr size_t MAX_VECTOR_MEMBERS = 8;
+
+        /**
+         * This constructs a scanner for the given set of characters.
+         *
+         * @param[in] set
+         *     This is the set of characters to scan for.
+         */
+        explicit CharSetScanner(const CharSet& set)
+            : set_(set)
+        {
+#ifdef STRING_EXTENSIONS_SSE2
+            if (set.GetSize() <= MAX_VECTOR_MEMBERS) {
+                char members[MAX_VECTOR_MEMBERS];
+                numMembers_ = set.GetMembers(members, MAX_VECTOR_MEMBERS);
+                for (size_t i = 0; i < numMembers_; ++i) {
+                    members_[i] = _mm_set1_epi8(members[i]);
+                }
+                useVectors_ = true;
+            }
+#endif /* STRING_EXTENSIONS_SSE2 */
+        }
+
+        /**
+         * This method finds the first character in the given range
+         * which is a member of the set.
+         *
+         * @param[in] begin
+         *     This points to the first character to scan.
+         *
+         * @param[in] end
+         *     This points just past the last character to scan.
+         *
+         * @return
+         *     A pointer to the first member of the set found is returned.
+         *     If no member of the set is found, end is returned.
+         */
+        const char* Find(const char* begin, const char* end) const {
+            auto p = begin;
+#ifdef STRING_EXTENSIONS_SSE2
+            if (useVectors_) {
+                while (end - p >= (ptrdiff_t)Simd::VECTOR_SIZE) {
+                    const auto mask = Simd::MoveMask(Match(Simd::Load(p)));
+                    if (mask != 0) {
+                        return p + Simd::CountTrailingZeros(mask);
+                    }
+                    p += Simd::VECTOR_SIZE;
+                }
+            }
+#endif /* STRING_EXTENSIONS_SSE2 */
+            while (
+                (p != end)
+                && !set_.Contains(*p)
+            ) {
+                ++p;
+            }
+            return p;
+        }
+
+        /**
+         * This method counts the characters in the given range
+         * which are members of the set.
+         *
+         * @param[in] begin
+         *     This points to the first character to scan.
+         *
+         * @param[in] end
+         *     This points just past the last character to scan.
+         *
+         * @return
+         *     The number of characters in the range which are
+         *     members of the set is returned.
+         */
+        size_t Count(const char* begin, const char* end) const {
+            size_t count = 0;
+            auto p = begin;
+#ifdef STRING_EXTENSIONS_SSE2
+            if (useVectors_) {
+                while (end - p >= (ptrdiff_t)Simd::VECTOR_SIZE) {
+                    // Each byte of the accumulator counts matches in
+                    // one lane, so it must be emptied before it can
+                    // overflow at 255.
+                    auto counts = _mm_setzero_si128();
+                    for (
+                        size_t i = 0;
+                        (i < 255) && (end - p >= (ptrdiff_t)Simd::VECTOR_SIZE);
+                        ++i, p += Simd::VECTOR_SIZE
+                    ) {
+                        counts = _mm_sub_epi8(counts, Match(Simd::Load(p)));
+                    }
+                    count += Simd::SumBytes(counts);
+                }
+            }
+#endif /* STRING_EXTENSIONS_SSE2 */
+            for (; p != end; ++p) {
+                if (set_.Contains(*p)) {
+                    ++count;
+                }
+            }
+            return count;
+        }
+
+        // Private methods
+    private:
+#ifdef STRING_EXTENSIONS_SSE2
+        /**
+         * This method compares each byte of the given vector with
+         * the members of the set.
+         *
+         * @param[in] v
+         *     This is the vector of bytes to compare.
+         *
+         * @return
+         *     A vector is returned whose bytes are all ones where the
+         *     corresponding byte of the input is a member of the set,
+         *     and zero elsewhere.
+         */
+        __m128i Match(__m128i v) const {
+            auto matches = _mm_setzero_si128();
+            for (size_t i = 0; i < numMembers_; ++i) {
+                matches = _mm_or_si128(matches, _mm_cmpeq_epi8(v, members_[i]));
+            }
+            return matches;
+        }
+#endif /* STRING_EXTENSIONS_SSE2 */
+
+        // Private properties
+    private:
+        /**
+         * This is the set of characters to scan for.
+         */
+        CharSet set_;
+
+#ifdef STRING_EXTENSIONS_SSE2
+        /**
+         * These are vectors with every byte set to one member of the set.
+         */
+        __m128i members_[MAX_VECTOR_MEMBERS];
+
+        /**
+         * This is the number of members of the set.
+         */
+        size_t numMembers_ = 0;
+
+        /**
+         * This indicates whether or not the set is small enough
+         * to be matched using vector comparisons.
+         */
+        bool useVectors_ = false;
+#endif /* STRING_EXTENSIONS_SSE2 */
+    };
+
+}
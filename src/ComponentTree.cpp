@@ -0,0 +1,236 @@
+/**
+ * @file ComponentTree.cpp
+ *
+ * This module contains the implementation of the
+ * StringExtensions::ComponentTree class.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include "Components.hpp"
+#include <StringExtensions/ComponentTree.hpp>
+#include <StringExtensions/Trim.hpp>
+#include <vector>
+
+namespace {
+
+    /**
+     * This is the number of node records in each block of
+     * the arena from which arrays of children are allocated.
+     */
+    constexpr size_t RECORDS_PER_BLOCK = 64;
+
+    /**
+     * This function determines whether or not the given character
+     * opens a delimited component.
+     *
+     * @param[in] c
+     *     This is the character to check.
+     *
+     * @return
+     *     An indication of whether or not the given character
+     *     opens a delimited component is returned.
+     */
+    bool IsOpeningDelimiter(char c) {
+        return (
+            (c == '[')
+            || (c == '{')
+            || (c == '(')
+            || (c == '<')
+        );
+    }
+
+}
+
+namespace StringExtensions {
+
+    /**
+     * This holds the state of a single node of a ComponentTree.
+     */
+    struct ComponentTree::Record {
+        /**
+         * This is the text of the node.
+         */
+        std::string_view text;
+
+        /**
+         * This points to the array of children of the node,
+         * once they have been discovered.
+         */
+        Record* children = nullptr;
+
+        /**
+         * This is the number of children of the node,
+         * once they have been discovered.
+         */
+        size_t numChildren = 0;
+
+        /**
+         * This indicates whether or not the children of
+         * the node have been discovered.
+         */
+        bool expanded = false;
+    };
+
+    /**
+     * This contains the private properties of a ComponentTree instance.
+     */
+    struct ComponentTree::Impl {
+        // Properties
+
+        /**
+         * This is the root node of the tree.
+         */
+        Record root;
+
+        /**
+         * These are the blocks of memory from which arrays
+         * of children are allocated.
+         */
+        std::vector< std::unique_ptr< Record[] > > blocks;
+
+        /**
+         * This points to the next unused record in the
+         * current block of the arena.
+         */
+        Record* nextRecord = nullptr;
+
+        /**
+         * This is the number of unused records remaining in the
+         * current block of the arena.
+         */
+        size_t recordsRemaining = 0;
+
+        /**
+         * This is used while discovering the children of a node,
+         * to hold their text until the number of children is known.
+         */
+        std::vector< std::string_view > scratch;
+
+        // Methods
+
+        /**
+         * This method allocates an array of records from the arena.
+         * Records never move once allocated.
+         *
+         * @param[in] count
+         *     This is the number of records to allocate.
+         *
+         * @return
+         *     A pointer to the first allocated record is returned.
+         */
+        Record* Allocate(size_t count) {
+            if (count > RECORDS_PER_BLOCK / 2) {
+                blocks.emplace_back(new Record[count]);
+                return blocks.back().get();
+            }
+            if (count > recordsRemaining) {
+                blocks.emplace_back(new Record[RECORDS_PER_BLOCK]);
+                nextRecord = blocks.back().get();
+                recordsRemaining = RECORDS_PER_BLOCK;
+            }
+            const auto records = nextRecord;
+            nextRecord += count;
+            recordsRemaining -= count;
+            return records;
+        }
+
+        /**
+         * This method discovers the children of the given node,
+         * if they haven't already been discovered.
+         *
+         * @param[in,out] record
+         *     This is the record of the node to expand.
+         */
+        void Expand(Record& record) {
+            if (record.expanded) {
+                return;
+            }
+            record.expanded = true;
+            const auto text = record.text;
+            if (
+                text.empty()
+                || !IsOpeningDelimiter(text[0])
+            ) {
+                return;
+            }
+            scratch.clear();
+            size_t begin = 1;
+            for (;;) {
+                bool closed;
+                const auto end = ScanComponent(text, begin, text.length(), closed);
+                const auto childEnd = (closed ? end - 1 : end);
+                scratch.push_back(TrimView(text.substr(begin, childEnd - begin)));
+                if (
+                    closed
+                    || (end >= text.length())
+                ) {
+                    break;
+                }
+                begin = end + 1;
+            }
+            if (
+                (scratch.size() == 1)
+                && scratch[0].empty()
+            ) {
+                return;
+            }
+            record.children = Allocate(scratch.size());
+            record.numChildren = scratch.size();
+            for (size_t i = 0; i < scratch.size(); ++i) {
+                record.children[i].text = scratch[i];
+            }
+        }
+    };
+
+    ComponentTree::Node::Node(Impl* tree, Record* record)
+        : tree_(tree)
+        , record_(record)
+    {
+    }
+
+    std::string_view ComponentTree::Node::GetText() const {
+        if (record_ == nullptr) {
+            return std::string_view();
+        }
+        return record_->text;
+    }
+
+    size_t ComponentTree::Node::GetNumChildren() const {
+        if (record_ == nullptr) {
+            return 0;
+        }
+        tree_->Expand(*record_);
+        return record_->numChildren;
+    }
+
+    auto ComponentTree::Node::GetChild(size_t index) const -> Node {
+        if (index >= GetNumChildren()) {
+            return Node();
+        }
+        return Node(tree_, &record_->children[index]);
+    }
+
+    auto ComponentTree::Node::operator[](size_t index) const -> Node {
+        return GetChild(index);
+    }
+
+    ComponentTree::Node::operator bool() const {
+        return (record_ != nullptr);
+    }
+
+    ComponentTree::~ComponentTree() noexcept = default;
+    ComponentTree::ComponentTree(ComponentTree&&) noexcept = default;
+    ComponentTree& ComponentTree::operator=(ComponentTree&&) noexcept = default;
+
+    ComponentTree::ComponentTree(std::string_view text)
+        : impl_(new Impl())
+    {
+        impl_->root.text = TrimView(text);
+    }
+
+    auto ComponentTree::GetRoot() const -> Node {
+        return Node(impl_.get(), &impl_->root);
+    }
+
+}
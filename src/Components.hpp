@@ -0,0 +1,50 @@
+#pragma once
+
+/**
+ * @file Components.hpp
+ *
+ * This module declares functions used internally by the library
+ * to scan delimited "components" of composite strings.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <stddef.h>
+#include <string_view>
+
+namespace StringExtensions {
+
+    /**
+     * This function scans the given string for the end of the next fully
+     * delimited "component", using the same rules as ParseComponent,
+     * but without copying anything.
+     *
+     * @param[in] s
+     *     This is the string from which to scan the next
+     *     delimited component.
+     *
+     * @param[in] begin
+     *     This is the starting position from which to scan
+     *     the next component.
+     *
+     * @param[in] end
+     *     This is the limit to which the string will be scanned
+     *     to determine the next component.
+     *
+     * @param[out] closed
+     *     This is set to indicate whether or not the scan stopped
+     *     because an "outer-most" closing delimiter was found,
+     *     in which case that delimiter is the last character
+     *     of the component.
+     *
+     * @return
+     *     The position just past the end of the component is returned.
+     */
+    size_t ScanComponent(
+        std::string_view s,
+        size_t begin,
+        size_t end,
+        bool& closed
+    );
+
+}
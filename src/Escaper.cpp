@@ -0,0 +1,99 @@
+/**
+ * @file Escaper.cpp
+ *
+ * This module contains the implementation of the
+ * StringExtensions::Escaper class.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include "CharSetScanner.hpp"
+#include <StringExtensions/Escaper.hpp>
+#include <utility>
+
+namespace StringExtensions {
+
+    /**
+     * This contains the private properties of an Escaper instance.
+     */
+    struct Escaper::Impl {
+        // Properties
+
+        /**
+         * This is the character to put in front of every character
+         * of the input that needs escaping.
+         */
+        char escapeCharacter;
+
+        /**
+         * This is used to find the characters to escape.
+         */
+        CharSetScanner scanner;
+
+        /**
+         * This is where to deliver the escaped text.
+         */
+        Sink sink;
+
+        // Methods
+
+        /**
+         * This is the constructor of the structure.
+         *
+         * @param[in] escapeCharacter
+         *     This is the character to put in front of every character
+         *     of the input that needs escaping.
+         *
+         * @param[in] charactersToEscape
+         *     These are the characters that should be escaped in the input.
+         *
+         * @param[in] sink
+         *     This is where to deliver the escaped text.
+         */
+        Impl(
+            char escapeCharacter,
+            const CharSet& charactersToEscape,
+            Sink sink
+        )
+            : escapeCharacter(escapeCharacter)
+            , scanner(charactersToEscape)
+            , sink(std::move(sink))
+        {
+        }
+    };
+
+    Escaper::~Escaper() noexcept = default;
+    Escaper::Escaper(Escaper&&) noexcept = default;
+    Escaper& Escaper::operator=(Escaper&&) noexcept = default;
+
+    Escaper::Escaper(
+        char escapeCharacter,
+        const CharSet& charactersToEscape,
+        Sink sink
+    )
+        : impl_(new Impl(escapeCharacter, charactersToEscape, std::move(sink)))
+    {
+    }
+
+    void Escaper::Write(std::string_view chunk) {
+        const std::string_view escapeCharacter(&impl_->escapeCharacter, 1);
+        auto runStart = chunk.data();
+        const auto end = runStart + chunk.length();
+        auto searchStart = runStart;
+        for (;;) {
+            const auto next = impl_->scanner.Find(searchStart, end);
+            if (next != runStart) {
+                impl_->sink(std::string_view(runStart, next - runStart));
+            }
+            if (next == end) {
+                break;
+            }
+            impl_->sink(escapeCharacter);
+
+            // The escaped character itself starts the next run.
+            runStart = next;
+            searchStart = next + 1;
+        }
+    }
+
+}
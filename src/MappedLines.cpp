@@ -0,0 +1,264 @@
+/**
+ * @file MappedLines.cpp
+ *
+ * This module contains the implementation of the
+ * StringExtensions::MappedLines class.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <string.h>
+#include <StringExtensions/MappedLines.hpp>
+#include <StringExtensions/StringExtensions.hpp>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#else /* POSIX */
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif /* _WIN32 / POSIX */
+
+namespace {
+
+    /**
+     * This is the number of bytes of the file to read past before
+     * releasing the pages which have been passed.
+     */
+    constexpr size_t RELEASE_INTERVAL = 16 * 1024 * 1024;
+
+}
+
+namespace StringExtensions {
+
+    /**
+     * This contains the private properties of a MappedLines instance.
+     */
+    struct MappedLines::Impl {
+        // Properties
+
+        /**
+         * This points to the mapping of the file, if one is open.
+         */
+        const char* data = nullptr;
+
+        /**
+         * This is the size of the file.
+         */
+        size_t size = 0;
+
+        /**
+         * This is the position of the next line to read.
+         */
+        size_t position = 0;
+
+        /**
+         * This is the position before which pages of the file
+         * have been released.
+         */
+        size_t released = 0;
+
+#ifdef _WIN32
+        /**
+         * This is the object representing the mapping of the file.
+         */
+        HANDLE mapping = NULL;
+#endif /* _WIN32 */
+
+        // Methods
+
+        /**
+         * This is the destructor of the structure.
+         */
+        ~Impl() noexcept {
+            Close();
+        }
+
+        /**
+         * This method maps the file at the given path into memory.
+         *
+         * @param[in] path
+         *     This is the path of the file to map.
+         *
+         * @return
+         *     An indication of whether or not the file was mapped
+         *     successfully is returned.
+         */
+        bool Map(const std::string& path) {
+#ifdef _WIN32
+            const auto file = CreateFileA(
+                path.c_str(),
+                GENERIC_READ,
+                FILE_SHARE_READ,
+                NULL,
+                OPEN_EXISTING,
+                FILE_FLAG_SEQUENTIAL_SCAN,
+                NULL
+            );
+            if (file == INVALID_HANDLE_VALUE) {
+                return false;
+            }
+            LARGE_INTEGER fileSize;
+            if (!GetFileSizeEx(file, &fileSize)) {
+                (void)CloseHandle(file);
+                return false;
+            }
+            size = (size_t)fileSize.QuadPart;
+            if (size > 0) {
+                mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+                if (mapping != NULL) {
+                    data = (const char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                }
+            }
+            (void)CloseHandle(file);
+            if (
+                (size > 0)
+                && (data == nullptr)
+            ) {
+                Close();
+                return false;
+            }
+            return true;
+#else /* POSIX */
+            const auto file = open(path.c_str(), O_RDONLY);
+            if (file < 0) {
+                return false;
+            }
+            struct stat fileStatus;
+            if (fstat(file, &fileStatus) != 0) {
+                (void)close(file);
+                return false;
+            }
+            size = (size_t)fileStatus.st_size;
+            if (size > 0) {
+                const auto mapping = mmap(NULL, size, PROT_READ, MAP_PRIVATE, file, 0);
+                if (mapping != MAP_FAILED) {
+                    data = (const char*)mapping;
+                    (void)madvise(mapping, size, MADV_SEQUENTIAL);
+                }
+            }
+            (void)close(file);
+            if (
+                (size > 0)
+                && (data == nullptr)
+            ) {
+                size = 0;
+                return false;
+            }
+            return true;
+#endif /* _WIN32 / POSIX */
+        }
+
+        /**
+         * This method unmaps the file, if it's mapped.
+         */
+        void Close() {
+#ifdef _WIN32
+            if (data != nullptr) {
+                (void)UnmapViewOfFile(data);
+            }
+            if (mapping != NULL) {
+                (void)CloseHandle(mapping);
+                mapping = NULL;
+            }
+#else /* POSIX */
+            if (data != nullptr) {
+                (void)munmap((void*)data, size);
+            }
+#endif /* _WIN32 / POSIX */
+            data = nullptr;
+            size = 0;
+            position = 0;
+            released = 0;
+        }
+
+        /**
+         * This method releases the pages of the file which have been
+         * passed, once enough of them have built up.  Pages holding
+         * any of the line about to be returned are kept, since the
+         * caller is likely to look at it right away.
+         *
+         * @param[in] lineStart
+         *     This is the position in the file of the start of the
+         *     line about to be returned.
+         */
+        void ReleasePassedPages(size_t lineStart) {
+            if (lineStart - released < RELEASE_INTERVAL) {
+                return;
+            }
+#ifdef _WIN32
+            // Windows trims pages of mapped files from the working set
+            // as needed, and the file was opened for sequential access,
+            // so nothing is done here.
+            released = lineStart;
+#else /* POSIX */
+            const auto pageSize = (size_t)sysconf(_SC_PAGESIZE);
+            const auto end = lineStart / pageSize * pageSize;
+            (void)madvise((void*)(data + released), end - released, MADV_DONTNEED);
+            released = end;
+#endif /* _WIN32 / POSIX */
+        }
+    };
+
+    MappedLines::~MappedLines() noexcept = default;
+    MappedLines::MappedLines(MappedLines&&) noexcept = default;
+    MappedLines& MappedLines::operator=(MappedLines&&) noexcept = default;
+
+    MappedLines::MappedLines()
+        : impl_(new Impl())
+    {
+    }
+
+    bool MappedLines::Open(const std::string& path) {
+        impl_->Close();
+        return impl_->Map(path);
+    }
+
+    void MappedLines::Close() {
+        impl_->Close();
+    }
+
+    size_t MappedLines::GetSize() const {
+        return impl_->size;
+    }
+
+    bool MappedLines::NextLine(std::string_view& line) {
+        if (impl_->position >= impl_->size) {
+            return false;
+        }
+        const auto lineStart = impl_->position;
+        const auto begin = impl_->data + lineStart;
+        const auto remaining = impl_->size - impl_->position;
+        const auto end = (const char*)memchr(begin, '\n', remaining);
+        if (end == nullptr) {
+            line = std::string_view(begin, remaining);
+            impl_->position = impl_->size;
+        } else {
+            line = std::string_view(begin, (size_t)(end - begin));
+            impl_->position += line.length() + 1;
+        }
+        if (
+            !line.empty()
+            && (line.back() == '\r')
+        ) {
+            line.remove_suffix(1);
+        }
+        impl_->ReleasePassedPages(lineStart);
+        return true;
+    }
+
+    bool MappedLines::NextRecord(
+        char d,
+        std::vector< std::string_view >& fields
+    ) {
+        std::string_view line;
+        if (!NextLine(line)) {
+            return false;
+        }
+        SplitInto(line, d, fields);
+        return true;
+    }
+
+}
@@ -0,0 +1,41 @@
+/**
+ * @file QuotedField.cpp
+ *
+ * This module contains the implementation of the
+ * StringExtensions::QuotedField class.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <string.h>
+#include <StringExtensions/QuotedField.hpp>
+
+namespace StringExtensions {
+
+    std::string QuotedField::GetValue() const {
+        if (!quoted_) {
+            return std::string(text_);
+        }
+        std::string value;
+        value.reserve(text_.length());
+        auto rest = text_;
+        for (;;) {
+            const auto next = (const char*)memchr(rest.data(), quote_, rest.length());
+            if (next == nullptr) {
+                value.append(rest);
+                break;
+            }
+            const auto runLength = (size_t)(next - rest.data()) + 1;
+            value.append(rest.substr(0, runLength));
+            rest.remove_prefix(runLength);
+            if (
+                !rest.empty()
+                && (rest[0] == quote_)
+            ) {
+                rest.remove_prefix(1);
+            }
+        }
+        return value;
+    }
+
+}
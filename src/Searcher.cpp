@@ -0,0 +1,260 @@
+/**
+ * @file Searcher.cpp
+ *
+ * This module contains the implementation of the
+ * StringExtensions::Searcher class.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include "Simd.hpp"
+#include <algorithm>
+#include <stdint.h>
+#include <string.h>
+#include <StringExtensions/Searcher.hpp>
+
+namespace {
+
+    /**
+     * This function finds the first instance of the given needle, which
+     * must be at least two bytes long, in the given haystack, by first
+     * finding places where both the first and last bytes of the needle
+     * match, and then comparing the bytes in between.  With SSE2,
+     * thirty-two places are checked at a time.
+     *
+     * @param[in] haystack
+     *     This is the string to search.
+     *
+     * @param[in] needle
+     *     This is the substring to find.
+     *
+     * @param[in] position
+     *     This is the position at which to start searching.
+     *
+     * @return
+     *     The position of the first instance of the needle found
+     *     is returned, or std::string_view::npos if it isn't found.
+     */
+    size_t FindByFirstAndLastBytes(
+        std::string_view haystack,
+        std::string_view needle,
+        size_t position
+    ) {
+        const auto h = haystack.data();
+        const auto n = haystack.length();
+        const auto m = needle.length();
+        const auto first = needle[0];
+        const auto last = needle[m - 1];
+        auto i = position;
+#ifdef STRING_EXTENSIONS_SSE2
+        const auto firstVector = _mm_set1_epi8(first);
+        const auto lastVector = _mm_set1_epi8(last);
+        const auto matches = [&](size_t offset){
+            return StringExtensions::Simd::MoveMask(
+                _mm_and_si128(
+                    _mm_cmpeq_epi8(StringExtensions::Simd::Load(h + offset), firstVector),
+                    _mm_cmpeq_epi8(StringExtensions::Simd::Load(h + offset + m - 1), lastVector)
+                )
+            );
+        };
+
+        // Two vectors are checked per iteration, since this measured
+        // about twice as fast as checking one at a time.
+        while (i + m - 1 + 2 * StringExtensions::Simd::VECTOR_SIZE <= n) {
+            auto mask = (
+                matches(i)
+                | (matches(i + StringExtensions::Simd::VECTOR_SIZE) << 16)
+            );
+            while (mask != 0) {
+                const auto candidate = i + StringExtensions::Simd::CountTrailingZeros(mask);
+                if (memcmp(h + candidate + 1, needle.data() + 1, m - 2) == 0) {
+                    return candidate;
+                }
+                mask &= mask - 1;
+            }
+            i += 2 * StringExtensions::Simd::VECTOR_SIZE;
+        }
+#endif /* STRING_EXTENSIONS_SSE2 */
+        while (i + m <= n) {
+            const auto candidate = (const char*)memchr(h + i, first, n - m + 1 - i);
+            if (candidate == nullptr) {
+                break;
+            }
+            i = (size_t)(candidate - h);
+            if (
+                (h[i + m - 1] == last)
+                && (memcmp(h + i + 1, needle.data() + 1, m - 2) == 0)
+            ) {
+                return i;
+            }
+            ++i;
+        }
+        return std::string_view::npos;
+    }
+
+    /**
+     * This function finds the maximal suffix of the given needle, in
+     * the lexicographic order given by comparing bytes either normally
+     * or in reverse, as the first step of the Two-Way algorithm.
+     *
+     * @param[in] needle
+     *     This is the needle whose maximal suffix is found.
+     *
+     * @param[in] reversed
+     *     This indicates whether or not to reverse the order
+     *     in which bytes are compared.
+     *
+     * @param[out] period
+     *     This is where to store the period of the suffix.
+     *
+     * @return
+     *     The position just before the start of the suffix is returned.
+     *     If the suffix is the whole needle, this wraps around to
+     *     the largest value of size_t.
+     */
+    size_t MaximalSuffix(
+        std::string_view needle,
+        bool reversed,
+        size_t& period
+    ) {
+        const auto n = (const uint8_t*)needle.data();
+        const auto m = needle.length();
+        size_t suffix = (size_t)-1;
+        size_t candidate = 0;
+        size_t k = 1;
+        period = 1;
+        while (candidate + k < m) {
+            const auto a = n[suffix + k];
+            const auto b = n[candidate + k];
+            if (a == b) {
+                if (k == period) {
+                    candidate += period;
+                    k = 1;
+                } else {
+                    ++k;
+                }
+            } else if (reversed ? (a < b) : (a > b)) {
+                candidate += k;
+                k = 1;
+                period = candidate - suffix;
+            } else {
+                suffix = candidate++;
+                k = period = 1;
+            }
+        }
+        return suffix;
+    }
+
+}
+
+namespace StringExtensions {
+
+    Searcher::Searcher(std::string_view needle)
+        : needle_(needle)
+    {
+        const auto m = needle_.length();
+        if (m < LONG_NEEDLE_LENGTH) {
+            return;
+        }
+        shift_.assign(256, 0);
+        for (size_t i = 0; i < m; ++i) {
+            shift_[(uint8_t)needle_[i]] = i + 1;
+        }
+
+        // The needle is split at the later of its maximal suffixes
+        // under the two orders of bytes, which gives a critical
+        // factorization of the needle.
+        size_t period;
+        size_t reversedPeriod;
+        split_ = MaximalSuffix(needle_, false, period);
+        const auto reversedSplit = MaximalSuffix(needle_, true, reversedPeriod);
+        if (reversedSplit + 1 > split_ + 1) {
+            split_ = reversedSplit;
+            period = reversedPeriod;
+        }
+        if (memcmp(needle_.data(), needle_.data() + period, split_ + 1) == 0) {
+            period_ = period;
+            periodicMemory_ = m - period;
+        } else {
+            period_ = std::max(split_, m - split_ - 1) + 1;
+            periodicMemory_ = 0;
+        }
+    }
+
+    size_t Searcher::Find(std::string_view haystack, size_t position) const {
+        const auto n = haystack.length();
+        const auto m = needle_.length();
+        if (
+            (position > n)
+            || (m > n - position)
+        ) {
+            return std::string_view::npos;
+        }
+        if (m == 0) {
+            return position;
+        } else if (m == 1) {
+            const auto found = (const char*)memchr(
+                haystack.data() + position,
+                needle_[0],
+                n - position
+            );
+            return (
+                (found == nullptr)
+                ? std::string_view::npos
+                : (size_t)(found - haystack.data())
+            );
+        }
+        if (m < LONG_NEEDLE_LENGTH) {
+            return FindByFirstAndLastBytes(haystack, needle_, position);
+        }
+
+        // This is the Two-Way algorithm.  The right half of the needle
+        // is compared first, then the left half.  The number of bytes
+        // at the start of the needle already known to match, after
+        // moving ahead by the period of a periodic needle, is
+        // remembered so they aren't compared again.
+        const auto h = (const uint8_t*)haystack.data();
+        const auto needle = (const uint8_t*)needle_.data();
+        const auto split = split_ + 1;
+        size_t memory = 0;
+        auto i = position;
+        while (i + m <= n) {
+            const auto shift = shift_[h[i + m - 1]];
+            if (shift == 0) {
+                i += m;
+                memory = 0;
+                continue;
+            } else if (shift < m) {
+                i += std::max(m - shift, memory);
+                memory = 0;
+                continue;
+            }
+            auto k = std::max(split, memory);
+            while (
+                (k < m)
+                && (needle[k] == h[i + k])
+            ) {
+                ++k;
+            }
+            if (k < m) {
+                i += k - split_;
+                memory = 0;
+                continue;
+            }
+            k = split;
+            while (
+                (k > memory)
+                && (needle[k - 1] == h[i + k - 1])
+            ) {
+                --k;
+            }
+            if (k <= memory) {
+                return i;
+            }
+            i += period_;
+            memory = periodicMemory_;
+        }
+        return std::string_view::npos;
+    }
+
+}
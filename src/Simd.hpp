@@ -0,0 +1,128 @@
+#pragma once
+
+/**
+ * @file Simd.hpp
+ *
+ * This module declares low-level helpers used internally by the library
+ * to scan strings many bytes at a time.
+ *
+ * When the target supports SSE2 (which every x86-64 target does),
+ * STRING_EXTENSIONS_SSE2 is defined, and vectorized code paths are used.
+ * Otherwise, equivalent scalar code paths are used.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define STRING_EXTENSIONS_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace StringExtensions {
+
+    namespace Simd {
+
+        /**
+         * This function returns the number of trailing zero bits
+         * in the given value, which must not be zero.
+         *
+         * @param[in] value
+         *     This is the value whose trailing zero bits are counted.
+         *
+         * @return
+         *     The number of trailing zero bits in the value is returned.
+         */
+        inline unsigned int CountTrailingZeros(uint32_t value) {
+#ifdef _MSC_VER
+            unsigned long index;
+            (void)_BitScanForward(&index, value);
+            return (unsigned int)index;
+#else
+            return (unsigned int)__builtin_ctz(value);
+#endif
+        }
+
+        /**
+         * This function returns the number of trailing zero bits
+         * in the given value, which must not be zero.
+         *
+         * @param[in] value
+         *     This is the value whose trailing zero bits are counted.
+         *
+         * @return
+         *     The number of trailing zero bits in the value is returned.
+         */
+        inline unsigned int CountTrailingZeros(uint64_t value) {
+#ifdef _MSC_VER
+            if ((uint32_t)value != 0) {
+                return CountTrailingZeros((uint32_t)value);
+            }
+            return 32 + CountTrailingZeros((uint32_t)(value >> 32));
+#else
+            return (unsigned int)__builtin_ctzll(value);
+#endif
+        }
+
+#ifdef STRING_EXTENSIONS_SSE2
+        /**
+         * This is the number of bytes in each vector.
+         */
+        constexpr size_t VECTOR_SIZE = 16;
+
+        /**
+         * This function loads a vector from the given memory,
+         * which need not be aligned.
+         *
+         * @param[in] p
+         *     This points to the bytes to load.
+         *
+         * @return
+         *     The loaded vector is returned.
+         */
+        inline __m128i Load(const char* p) {
+            return _mm_loadu_si128((const __m128i*)p);
+        }
+
+        /**
+         * This function returns a bitmask with one bit per byte of the
+         * given comparison result, set where the byte is all ones.
+         *
+         * @param[in] matches
+         *     This is the result of comparing vectors bytewise.
+         *
+         * @return
+         *     The bitmask of matching bytes is returned.
+         */
+        inline uint32_t MoveMask(__m128i matches) {
+            return (uint32_t)_mm_movemask_epi8(matches);
+        }
+
+        /**
+         * This function returns the sum of the bytes of the given
+         * vector, treating each byte as an unsigned integer.
+         *
+         * @param[in] v
+         *     This is the vector whose bytes are summed.
+         *
+         * @return
+         *     The sum of the bytes of the vector is returned.
+         */
+        inline size_t SumBytes(__m128i v) {
+            const auto sums = _mm_sad_epu8(v, _mm_setzero_si128());
+            return (
+                (size_t)_mm_cvtsi128_si32(sums)
+                + (size_t)_mm_cvtsi128_si32(_mm_srli_si128(sums, 8))
+            );
+        }
+#endif /* STRING_EXTENSIONS_SSE2 */
+
+    }
+
+}
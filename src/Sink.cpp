@@ -0,0 +1,20 @@
+/**
+ * @file Sink.cpp
+ *
+ * This module contains the implementation of helpers
+ * related to the StringExtensions::Sink type.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <StringExtensions/Sink.hpp>
+
+namespace StringExtensions {
+
+    Sink MakeStreamSink(std::ostream& stream) {
+        return [&stream](std::string_view data){
+            (void)stream.write(data.data(), (std::streamsize)data.length());
+        };
+    }
+
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+/**
+ * @file Split.hpp
+ *
+ * This module declares functions used internally by the library
+ * to break strings into pieces without copying them.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <stddef.h>
+#include <string_view>
+#include <StringExtensions/SplitPolicy.hpp>
+
+namespace StringExtensions {
+
+    /**
+     * This function breaks the given string into pieces, in the same way
+     * as Split, handing each piece to the given function as a view
+     * into the string.  The string is scanned once, from front to back.
+     *
+     * @param[in] s
+     *     This is the string to split.
+     *
+     * @param[in] findDelimiter
+     *     This is the function to call to find the next delimiter.
+     *     It is given the rest of the string to scan and a reference
+     *     through which to store the length of the delimiter found,
+     *     and it returns the position of the delimiter, or
+     *     std::string_view::npos if there is none.
+     *
+     * @param[in] emit
+     *     This is the function to call with each piece.
+     */
+    template< typename FindDelimiter, typename Emit > void SplitPieces(
+        std::string_view s,
+        FindDelimiter&& findDelimiter,
+        Emit&& emit
+    ) {
+        SplitWithPolicy< SplitPolicy<> >(s, findDelimiter, emit);
+    }
+
+}
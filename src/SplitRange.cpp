@@ -0,0 +1,67 @@
+/**
+ * @file SplitRange.cpp
+ *
+ * This module contains the implementation of the
+ * StringExtensions::SplitRange class.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <string.h>
+#include <StringExtensions/SplitRange.hpp>
+#include <StringExtensions/Trim.hpp>
+
+namespace StringExtensions {
+
+    SplitRange::Iterator::Iterator(
+        std::string_view s,
+        std::string_view delimiter,
+        char delimiterCharacter,
+        bool substringDelimiter
+    )
+        : remainder_(TrimView(s))
+        , delimiter_(delimiter)
+        , delimiterCharacter_(delimiterCharacter)
+        , substringDelimiter_(substringDelimiter)
+        , atEnd_(false)
+    {
+        Advance();
+    }
+
+    void SplitRange::Iterator::Advance() {
+        if (remainder_.empty()) {
+            *this = Iterator();
+            return;
+        }
+        size_t delimiter;
+        size_t delimiterLength;
+        if (substringDelimiter_) {
+            delimiter = (
+                delimiter_.empty()
+                ? std::string_view::npos
+                : remainder_.find(delimiter_)
+            );
+            delimiterLength = delimiter_.length();
+        } else {
+            const auto next = (const char*)memchr(
+                remainder_.data(),
+                delimiterCharacter_,
+                remainder_.length()
+            );
+            delimiter = (
+                (next == nullptr)
+                ? std::string_view::npos
+                : (size_t)(next - remainder_.data())
+            );
+            delimiterLength = 1;
+        }
+        if (delimiter == std::string_view::npos) {
+            piece_ = remainder_;
+            remainder_ = remainder_.substr(remainder_.length());
+        } else {
+            piece_ = TrimBackView(remainder_.substr(0, delimiter));
+            remainder_ = TrimFrontView(remainder_.substr(delimiter + delimiterLength));
+        }
+    }
+
+}
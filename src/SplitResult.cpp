@@ -0,0 +1,85 @@
+/**
+ * @file SplitResult.cpp
+ *
+ * This module contains the implementation of the
+ * StringExtensions::SplitResult class.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <StringExtensions/SplitResult.hpp>
+#include <StringExtensions/StringExtensions.hpp>
+#include <utility>
+
+namespace StringExtensions {
+
+    SplitResult::SplitResult(const SplitResult& other)
+        : buffer_(other.buffer_)
+        , pieces_(other.pieces_)
+    {
+        Rebase(other.buffer_.data());
+    }
+
+    SplitResult::SplitResult(SplitResult&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    SplitResult& SplitResult::operator=(const SplitResult& other) {
+        if (this != &other) {
+            buffer_ = other.buffer_;
+            pieces_ = other.pieces_;
+            Rebase(other.buffer_.data());
+        }
+        return *this;
+    }
+
+    SplitResult& SplitResult::operator=(SplitResult&& other) noexcept {
+        if (this != &other) {
+            // A short string may be held within the string object
+            // itself, in which case moving it moves its characters.
+            const auto previousData = other.buffer_.data();
+            buffer_ = std::move(other.buffer_);
+            pieces_ = std::move(other.pieces_);
+            Rebase(previousData);
+            other.buffer_.clear();
+            other.pieces_.clear();
+        }
+        return *this;
+    }
+
+    SplitResult::SplitResult(
+        std::string&& s,
+        char d
+    )
+        : buffer_(std::move(s))
+    {
+        SplitInto(buffer_, d, pieces_);
+    }
+
+    SplitResult::SplitResult(
+        std::string&& s,
+        std::string_view d
+    )
+        : buffer_(std::move(s))
+    {
+        SplitInto(buffer_, d, pieces_);
+    }
+
+    std::vector< std::string > SplitResult::ToStrings() const {
+        return std::vector< std::string >(pieces_.begin(), pieces_.end());
+    }
+
+    void SplitResult::Rebase(const char* previousData) {
+        const auto data = buffer_.data();
+        if (data == previousData) {
+            return;
+        }
+        for (auto& piece: pieces_) {
+            piece = std::string_view(
+                data + (piece.data() - previousData),
+                piece.length()
+            );
+        }
+    }
+
+}
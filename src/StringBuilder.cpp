@@ -0,0 +1,132 @@
+/**
+ * @file StringBuilder.cpp
+ *
+ * This module contains the implementation of the
+ * StringExtensions::StringBuilder class.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <algorithm>
+#include <StringExtensions/StringBuilder.hpp>
+#include <utility>
+
+namespace {
+
+    /**
+     * This is the number of characters the first chunk can hold.
+     */
+    constexpr size_t FIRST_CHUNK_SIZE = 256;
+
+}
+
+namespace StringExtensions {
+
+    StringBuilder::~StringBuilder() noexcept = default;
+
+    StringBuilder::StringBuilder(StringBuilder&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    StringBuilder& StringBuilder::operator=(StringBuilder&& other) noexcept {
+        if (this != &other) {
+            // The chunks themselves don't move, so the pointers
+            // into the last one remain valid.
+            chunks_ = std::move(other.chunks_);
+            next_ = other.next_;
+            end_ = other.end_;
+            length_ = other.length_;
+            other.chunks_.clear();
+            other.next_ = nullptr;
+            other.end_ = nullptr;
+            other.length_ = 0;
+        }
+        return *this;
+    }
+
+    StringBuilder::StringBuilder() = default;
+
+    void StringBuilder::Append(
+        size_t count,
+        char c
+    ) {
+        while (count > 0) {
+            if (next_ == end_) {
+                Grow(count);
+            }
+            const auto amount = std::min(count, (size_t)(end_ - next_));
+            (void)memset(next_, c, amount);
+            next_ += amount;
+            length_ += amount;
+            count -= amount;
+        }
+    }
+
+    std::string StringBuilder::ToString() const {
+        std::string result(length_, '\0');
+        auto next = &result[0];
+        for (const auto& chunk: GetChunks()) {
+            (void)memcpy(next, chunk.data(), chunk.length());
+            next += chunk.length();
+        }
+        return result;
+    }
+
+    std::vector< std::string_view > StringBuilder::GetChunks() const {
+        std::vector< std::string_view > chunks;
+        chunks.reserve(chunks_.size());
+        for (size_t i = 0; i < chunks_.size(); ++i) {
+            const auto& chunk = chunks_[i];
+            const auto length = (
+                (i + 1 == chunks_.size())
+                ? (size_t)(next_ - chunk.data.get())
+                : chunk.capacity
+            );
+            if (length > 0) {
+                chunks.emplace_back(chunk.data.get(), length);
+            }
+        }
+        return chunks;
+    }
+
+    void StringBuilder::Clear() {
+        if (!chunks_.empty()) {
+            if (chunks_.size() > 1) {
+                auto largest = std::move(chunks_.back());
+                chunks_.clear();
+                chunks_.push_back(std::move(largest));
+            }
+            next_ = chunks_.back().data.get();
+            end_ = next_ + chunks_.back().capacity;
+        }
+        length_ = 0;
+    }
+
+    void StringBuilder::AppendSlow(std::string_view s) {
+        const auto amount = (size_t)(end_ - next_);
+        if (amount > 0) {
+            (void)memcpy(next_, s.data(), amount);
+            next_ += amount;
+            length_ += amount;
+            s.remove_prefix(amount);
+        }
+        Grow(s.length());
+        (void)memcpy(next_, s.data(), s.length());
+        next_ += s.length();
+        length_ += s.length();
+    }
+
+    void StringBuilder::Grow(size_t minimum) {
+        const auto capacity = std::max(
+            minimum,
+            chunks_.empty() ? FIRST_CHUNK_SIZE : chunks_.back().capacity * 2
+        );
+        Chunk chunk;
+        chunk.data.reset(new char[capacity]);
+        chunk.capacity = capacity;
+        next_ = chunk.data.get();
+        end_ = next_ + capacity;
+        chunks_.push_back(std::move(chunk));
+    }
+
+}
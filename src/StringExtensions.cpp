@@ -7,13 +7,763 @@
  * Copyright © 2014-2019 by Richard Walters
  */
 
+#include "CharSetScanner.hpp"
+#include "Components.hpp"
+#include "Simd.hpp"
+#include "Split.hpp"
+#include <algorithm>
 #include <limits>
 #include <stdarg.h>
+#include <stdint.h>
 #include <stdlib.h>
-#include <sstream>
+#include <string.h>
+#include <StringExtensions/Searcher.hpp>
+#include <StringExtensions/StringBuilder.hpp>
 #include <StringExtensions/StringExtensions.hpp>
+#include <StringExtensions/Trim.hpp>
+#include <thread>
 #include <vector>
 
+namespace {
+
+    /**
+     * This function returns a copy of the given input string, modified
+     * so that every character matched by the given scanner is prefixed
+     * by the given escape character.
+     *
+     * @param[in] s
+     *     This is the input string.
+     *
+     * @param[in] first
+     *     This is the position of the first character in the input
+     *     string which might need escaping.  Everything before it is
+     *     copied without scanning.
+     *
+     * @param[in] escapeCharacter
+     *     This is the character to put in front of every character
+     *     in the input string that is matched by the scanner.
+     *
+     * @param[in] scanner
+     *     This is used to find the characters to escape.
+     *
+     * @param[in] numEscapes
+     *     This is the number of characters in the input string
+     *     which need escaping, used to size the output exactly.
+     *
+     * @return
+     *     The escaped copy of the input string is returned.
+     */
+    std::string EscapeWithScanner(
+        std::string_view s,
+        size_t first,
+        char escapeCharacter,
+        const StringExtensions::CharSetScanner& scanner,
+        size_t numEscapes
+    ) {
+        std::string output;
+        output.reserve(s.length() + numEscapes);
+        output.append(s.data(), first);
+        auto p = s.data() + first;
+        const auto end = s.data() + s.length();
+        for (;;) {
+            const auto next = scanner.Find(p, end);
+            output.append(p, next - p);
+            if (next == end) {
+                break;
+            }
+            output += escapeCharacter;
+            output += *next;
+            p = next + 1;
+        }
+        return output;
+    }
+
+    /**
+     * This function determines whether or not the given character
+     * needs to be escaped in a JSON string.
+     *
+     * @param[in] c
+     *     This is the character to check.
+     *
+     * @return
+     *     An indication of whether or not the given character
+     *     needs to be escaped in a JSON string is returned.
+     */
+    bool IsJsonSpecial(char c) {
+        return (
+            ((uint8_t)c < 0x20)
+            || (c == '"')
+            || (c == '\\')
+        );
+    }
+
+    /**
+     * This function determines whether or not the given character
+     * needs to be escaped in a C string literal.
+     *
+     * @param[in] c
+     *     This is the character to check.
+     *
+     * @return
+     *     An indication of whether or not the given character
+     *     needs to be escaped in a C string literal is returned.
+     */
+    bool IsCLiteralSpecial(char c) {
+        return (
+            ((uint8_t)c < 0x20)
+            || ((uint8_t)c >= 0x7F)
+            || (c == '"')
+            || (c == '\\')
+        );
+    }
+
+    /**
+     * This function finds the first character in the given range
+     * which needs to be escaped in a JSON string.
+     *
+     * @param[in] p
+     *     This points to the first character to scan.
+     *
+     * @param[in] end
+     *     This points just past the last character to scan.
+     *
+     * @return
+     *     A pointer to the first character found which needs to be
+     *     escaped is returned.  If there is none, end is returned.
+     */
+    const char* FindJsonSpecial(const char* p, const char* end) {
+#ifdef STRING_EXTENSIONS_SSE2
+        const auto quote = _mm_set1_epi8('"');
+        const auto backslash = _mm_set1_epi8('\\');
+        const auto lastControl = _mm_set1_epi8(0x1F);
+        while (end - p >= (ptrdiff_t)StringExtensions::Simd::VECTOR_SIZE) {
+            const auto v = StringExtensions::Simd::Load(p);
+            const auto matches = _mm_or_si128(
+                _mm_or_si128(
+                    _mm_cmpeq_epi8(v, quote),
+                    _mm_cmpeq_epi8(v, backslash)
+                ),
+                _mm_cmpeq_epi8(_mm_max_epu8(v, lastControl), lastControl)
+            );
+            const auto mask = StringExtensions::Simd::MoveMask(matches);
+            if (mask != 0) {
+                return p + StringExtensions::Simd::CountTrailingZeros(mask);
+            }
+            p += StringExtensions::Simd::VECTOR_SIZE;
+        }
+#endif /* STRING_EXTENSIONS_SSE2 */
+        while (
+            (p != end)
+            && !IsJsonSpecial(*p)
+        ) {
+            ++p;
+        }
+        return p;
+    }
+
+    /**
+     * This function finds the first character in the given range
+     * which needs to be escaped in a C string literal.
+     *
+     * @param[in] p
+     *     This points to the first character to scan.
+     *
+     * @param[in] end
+     *     This points just past the last character to scan.
+     *
+     * @return
+     *     A pointer to the first character found which needs to be
+     *     escaped is returned.  If there is none, end is returned.
+     */
+    const char* FindCLiteralSpecial(const char* p, const char* end) {
+#ifdef STRING_EXTENSIONS_SSE2
+        const auto quote = _mm_set1_epi8('"');
+        const auto backslash = _mm_set1_epi8('\\');
+        const auto lastControl = _mm_set1_epi8(0x1F);
+        const auto firstNonPrintable = _mm_set1_epi8(0x7F);
+        while (end - p >= (ptrdiff_t)StringExtensions::Simd::VECTOR_SIZE) {
+            const auto v = StringExtensions::Simd::Load(p);
+            const auto matches = _mm_or_si128(
+                _mm_or_si128(
+                    _mm_cmpeq_epi8(v, quote),
+                    _mm_cmpeq_epi8(v, backslash)
+                ),
+                _mm_or_si128(
+                    _mm_cmpeq_epi8(_mm_max_epu8(v, lastControl), lastControl),
+                    _mm_cmpeq_epi8(_mm_min_epu8(v, firstNonPrintable), firstNonPrintable)
+                )
+            );
+            const auto mask = StringExtensions::Simd::MoveMask(matches);
+            if (mask != 0) {
+                return p + StringExtensions::Simd::CountTrailingZeros(mask);
+            }
+            p += StringExtensions::Simd::VECTOR_SIZE;
+        }
+#endif /* STRING_EXTENSIONS_SSE2 */
+        while (
+            (p != end)
+            && !IsCLiteralSpecial(*p)
+        ) {
+            ++p;
+        }
+        return p;
+    }
+
+    /**
+     * This function copies the given number of characters from the
+     * given input to the given output, changing the case of the ASCII
+     * letters in the given range by adding the given difference to them.
+     * All other characters are copied unchanged.  The input and output
+     * may be the same, to change the case in place.
+     *
+     * @param[in] in
+     *     This points to the characters to convert.
+     *
+     * @param[out] out
+     *     This points to where to store the converted characters.
+     *
+     * @param[in] length
+     *     This is the number of characters to convert.
+     *
+     * @param[in] first
+     *     This is the first letter of the range of letters to convert,
+     *     either 'A' or 'a'.
+     *
+     * @param[in] difference
+     *     This is the amount to add to each letter converted.
+     */
+    void ChangeCase(
+        const char* in,
+        char* out,
+        size_t length,
+        char first,
+        char difference
+    ) {
+        size_t i = 0;
+#ifdef STRING_EXTENSIONS_SSE2
+        // The letters are moved to the bottom of the signed range,
+        // so that one signed comparison picks them out.
+        const auto offset = _mm_set1_epi8((char)(0x80 - first));
+        const auto limit = _mm_set1_epi8(-128 + 26);
+        const auto adjustment = _mm_set1_epi8(difference);
+        const auto convert = [&](size_t position){
+            const auto v = StringExtensions::Simd::Load(in + position);
+            const auto letters = _mm_cmplt_epi8(_mm_add_epi8(v, offset), limit);
+            _mm_storeu_si128(
+                (__m128i*)(out + position),
+                _mm_add_epi8(v, _mm_and_si128(letters, adjustment))
+            );
+        };
+        while (length - i >= StringExtensions::Simd::VECTOR_SIZE) {
+            convert(i);
+            i += StringExtensions::Simd::VECTOR_SIZE;
+        }
+
+        // The last few characters are converted with one more vector
+        // ending at the end of the string, overlapping some characters
+        // already converted.  Those are no longer letters of the range
+        // being converted, so converting them again changes nothing.
+        if (
+            (i < length)
+            && (length >= StringExtensions::Simd::VECTOR_SIZE)
+        ) {
+            convert(length - StringExtensions::Simd::VECTOR_SIZE);
+            return;
+        }
+#endif /* STRING_EXTENSIONS_SSE2 */
+        for (; i < length; ++i) {
+            const auto c = in[i];
+            out[i] = (
+                ((unsigned char)(c - first) < 26)
+                ? (char)(c + difference)
+                : c
+            );
+        }
+    }
+
+    /**
+     * This function returns the value of the given hexadecimal digit.
+     *
+     * @param[in] c
+     *     This is the character to interpret as a hexadecimal digit.
+     *
+     * @return
+     *     The value of the digit is returned, or -1 if the character
+     *     is not a hexadecimal digit.
+     */
+    int HexDigitValue(char c) {
+        if ((c >= '0') && (c <= '9')) {
+            return c - '0';
+        } else if ((c >= 'a') && (c <= 'f')) {
+            return c - 'a' + 10;
+        } else if ((c >= 'A') && (c <= 'F')) {
+            return c - 'A' + 10;
+        } else {
+            return -1;
+        }
+    }
+
+    /**
+     * This function parses the given number of hexadecimal digits
+     * from the given position of the given string.
+     *
+     * @param[in] s
+     *     This is the string containing the digits.
+     *
+     * @param[in] position
+     *     This is the position of the first digit.
+     *
+     * @param[in] numDigits
+     *     This is the number of digits to parse.
+     *
+     * @param[out] value
+     *     This is where to store the value parsed.
+     *
+     * @return
+     *     An indication of whether or not the given number of
+     *     hexadecimal digits were found and parsed is returned.
+     */
+    bool ParseHexDigits(
+        std::string_view s,
+        size_t position,
+        size_t numDigits,
+        uint32_t& value
+    ) {
+        if (s.length() - position < numDigits) {
+            return false;
+        }
+        value = 0;
+        for (size_t i = 0; i < numDigits; ++i) {
+            const auto digit = HexDigitValue(s[position + i]);
+            if (digit < 0) {
+                return false;
+            }
+            value = (value << 4) + (uint32_t)digit;
+        }
+        return true;
+    }
+
+    /**
+     * This function appends the UTF-8 encoding of the given
+     * Unicode code point to the given string.
+     *
+     * @param[in,out] output
+     *     This is the string to which to append the encoding.
+     *
+     * @param[in] codePoint
+     *     This is the code point to encode.
+     */
+    void AppendUtf8(std::string& output, uint32_t codePoint) {
+        if (codePoint < 0x80) {
+            output += (char)codePoint;
+        } else if (codePoint < 0x800) {
+            output += (char)(0xC0 | (codePoint >> 6));
+            output += (char)(0x80 | (codePoint & 0x3F));
+        } else if (codePoint < 0x10000) {
+            output += (char)(0xE0 | (codePoint >> 12));
+            output += (char)(0x80 | ((codePoint >> 6) & 0x3F));
+            output += (char)(0x80 | (codePoint & 0x3F));
+        } else {
+            output += (char)(0xF0 | (codePoint >> 18));
+            output += (char)(0x80 | ((codePoint >> 12) & 0x3F));
+            output += (char)(0x80 | ((codePoint >> 6) & 0x3F));
+            output += (char)(0x80 | (codePoint & 0x3F));
+        }
+    }
+
+    /**
+     * This function determines whether or not the given code point
+     * is a UTF-16 surrogate, which can't be encoded on its own.
+     *
+     * @param[in] codePoint
+     *     This is the code point to check.
+     *
+     * @return
+     *     An indication of whether or not the given code point
+     *     is a UTF-16 surrogate is returned.
+     */
+    bool IsSurrogate(uint32_t codePoint) {
+        return (
+            (codePoint >= 0xD800)
+            && (codePoint <= 0xDFFF)
+        );
+    }
+
+    /**
+     * This is the function object used with SplitPieces
+     * to split strings at a delimiter character.
+     */
+    struct FindCharacter {
+        /**
+         * This is the delimiter character.
+         */
+        char d;
+
+        /**
+         * This constructs the function object.
+         *
+         * @param[in] d
+         *     This is the delimiter character.
+         */
+        explicit FindCharacter(char d)
+            : d(d)
+        {
+        }
+
+        /**
+         * This finds the next delimiter in the given string.
+         *
+         * @param[in] s
+         *     This is the string to scan.
+         *
+         * @param[out] delimiterLength
+         *     This is where to store the length of the delimiter.
+         *
+         * @return
+         *     The position of the next delimiter, or npos if there is
+         *     none, is returned.
+         */
+        size_t operator()(std::string_view s, size_t& delimiterLength) const {
+            delimiterLength = 1;
+            const auto next = (const char*)memchr(s.data(), d, s.length());
+            if (next == nullptr) {
+                return std::string_view::npos;
+            }
+            return (size_t)(next - s.data());
+        }
+    };
+
+    /**
+     * This is the function object used with SplitPieces
+     * to split strings at any character of a set.
+     */
+    struct FindAnyCharacter {
+        /**
+         * This is used to find the delimiter characters.
+         */
+        StringExtensions::CharSetScanner scanner;
+
+        /**
+         * This constructs the function object.
+         *
+         * @param[in] d
+         *     This is the set of delimiter characters.
+         */
+        explicit FindAnyCharacter(const StringExtensions::CharSet& d)
+            : scanner(d)
+        {
+        }
+
+        /**
+         * This finds the next delimiter in the given string.
+         *
+         * @param[in] s
+         *     This is the string to scan.
+         *
+         * @param[out] delimiterLength
+         *     This is where to store the length of the delimiter.
+         *
+         * @return
+         *     The position of the next delimiter, or npos if there is
+         *     none, is returned.
+         */
+        size_t operator()(std::string_view s, size_t& delimiterLength) const {
+            delimiterLength = 1;
+            const auto end = s.data() + s.length();
+            const auto next = scanner.Find(s.data(), end);
+            if (next == end) {
+                return std::string_view::npos;
+            }
+            return (size_t)(next - s.data());
+        }
+    };
+
+    /**
+     * This is the function object used with SplitPieces
+     * to split strings at a delimiter substring.
+     */
+    struct FindSubstring {
+        /**
+         * This is used to find the delimiter substring.
+         */
+        StringExtensions::Searcher searcher;
+
+        /**
+         * This constructs the function object.
+         *
+         * @param[in] d
+         *     This is the delimiter substring.
+         */
+        explicit FindSubstring(std::string_view d)
+            : searcher(d)
+        {
+        }
+
+        /**
+         * This finds the next delimiter in the given string.
+         *
+         * @param[in] s
+         *     This is the string to scan.
+         *
+         * @param[out] delimiterLength
+         *     This is where to store the length of the delimiter.
+         *
+         * @return
+         *     The position of the next delimiter, or npos if there is
+         *     none (or the delimiter is empty), is returned.
+         */
+        size_t operator()(std::string_view s, size_t& delimiterLength) const {
+            delimiterLength = searcher.GetNeedle().length();
+            if (delimiterLength == 0) {
+                return std::string_view::npos;
+            }
+            return searcher.Find(s);
+        }
+    };
+
+    /**
+     * This function breaks the given string into pieces using the given
+     * delimiter finder, and stores copies of the pieces in the given
+     * collection, reusing the strings already in it.
+     *
+     * @param[in] s
+     *     This is the string to split.
+     *
+     * @param[in] findDelimiter
+     *     This is the function object used to find each delimiter.
+     *
+     * @param[in,out] values
+     *     This is where to store the pieces.
+     */
+    template< typename FindDelimiter > void AssignPieces(
+        std::string_view s,
+        FindDelimiter&& findDelimiter,
+        std::vector< std::string >& values
+    ) {
+        size_t numValues = 0;
+        StringExtensions::SplitPieces(
+            s,
+            findDelimiter,
+            [&values, &numValues](std::string_view piece){
+                if (numValues < values.size()) {
+                    values[numValues].assign(piece.data(), piece.length());
+                } else {
+                    values.emplace_back(piece);
+                }
+                ++numValues;
+            }
+        );
+        values.resize(numValues);
+    }
+
+    /**
+     * This is the number of bytes of a record scanned at once
+     * by SplitQuoted, one per bit of the masks it builds.
+     */
+    constexpr size_t QUOTED_BLOCK_SIZE = 64;
+
+    /**
+     * This function builds bitmasks of the positions of the quote and
+     * delimiter characters in the given block of a record.
+     *
+     * @param[in] block
+     *     This points to the block, which must have QUOTED_BLOCK_SIZE
+     *     bytes.
+     *
+     * @param[in] d
+     *     This is the delimiter character.
+     *
+     * @param[in] quote
+     *     This is the quote character.
+     *
+     * @param[out] quotes
+     *     This is where to store the mask of quote characters.
+     *
+     * @param[out] delimiters
+     *     This is where to store the mask of delimiter characters.
+     */
+    void FindQuotesAndDelimiters(
+        const char* block,
+        char d,
+        char quote,
+        uint64_t& quotes,
+        uint64_t& delimiters
+    ) {
+        quotes = 0;
+        delimiters = 0;
+#ifdef STRING_EXTENSIONS_SSE2
+        const auto quoteVector = _mm_set1_epi8(quote);
+        const auto delimiterVector = _mm_set1_epi8(d);
+        for (size_t i = 0; i < QUOTED_BLOCK_SIZE; i += StringExtensions::Simd::VECTOR_SIZE) {
+            const auto v = StringExtensions::Simd::Load(block + i);
+            quotes |= (uint64_t)StringExtensions::Simd::MoveMask(_mm_cmpeq_epi8(v, quoteVector)) << i;
+            delimiters |= (uint64_t)StringExtensions::Simd::MoveMask(_mm_cmpeq_epi8(v, delimiterVector)) << i;
+        }
+#else /* not STRING_EXTENSIONS_SSE2 */
+        for (size_t i = 0; i < QUOTED_BLOCK_SIZE; ++i) {
+            if (block[i] == quote) {
+                quotes |= (uint64_t)1 << i;
+            } else if (block[i] == d) {
+                delimiters |= (uint64_t)1 << i;
+            }
+        }
+#endif /* STRING_EXTENSIONS_SSE2 / not STRING_EXTENSIONS_SSE2 */
+    }
+
+    /**
+     * This function computes the prefix XOR of the given bits, so that
+     * each bit of the result is the parity of the given bits at and
+     * below it.  Given a mask of quote characters, the result marks
+     * the characters which are within quotes (counting each opening
+     * quote, but not its closing quote, as within them).
+     *
+     * @param[in] bits
+     *     These are the bits to combine.
+     *
+     * @return
+     *     The prefix XOR of the given bits is returned.
+     */
+    uint64_t PrefixXor(uint64_t bits) {
+        bits ^= bits << 1;
+        bits ^= bits << 2;
+        bits ^= bits << 4;
+        bits ^= bits << 8;
+        bits ^= bits << 16;
+        bits ^= bits << 32;
+        return bits;
+    }
+
+    /**
+     * This function makes a field of a quoted record from its raw text,
+     * removing the quotes enclosing it if it is quoted.
+     *
+     * @param[in] raw
+     *     This is the raw text of the field.
+     *
+     * @param[in] quote
+     *     This is the quote character.
+     *
+     * @param[in] closed
+     *     This indicates whether or not the quotes of the field,
+     *     if any, were closed.
+     *
+     * @return
+     *     The field is returned.
+     */
+    StringExtensions::QuotedField MakeQuotedField(
+        std::string_view raw,
+        char quote,
+        bool closed
+    ) {
+        if (
+            raw.empty()
+            || (raw[0] != quote)
+        ) {
+            return StringExtensions::QuotedField(raw, false, quote);
+        }
+        raw.remove_prefix(1);
+        if (
+            closed
+            && !raw.empty()
+            && (raw.back() == quote)
+        ) {
+            raw.remove_suffix(1);
+        }
+        return StringExtensions::QuotedField(raw, true, quote);
+    }
+
+    /**
+     * This is the smallest number of bytes SplitViewParallel
+     * gives to each thread.
+     */
+    constexpr size_t MIN_PARALLEL_PARTITION_SIZE = 1 << 20;
+
+    /**
+     * This function calls the given function once for each of the given
+     * number of tasks, passing it the index of the task, with each call
+     * made on its own thread.  The first task is run on the calling
+     * thread.  The function returns once every task has completed.
+     *
+     * @param[in] numTasks
+     *     This is the number of tasks to run.
+     *
+     * @param[in] task
+     *     This is the function to call for each task.
+     */
+    template< typename Task > void RunInParallel(
+        size_t numTasks,
+        Task&& task
+    ) {
+        std::vector< std::thread > threads;
+        threads.reserve(numTasks - 1);
+        for (size_t i = 1; i < numTasks; ++i) {
+            threads.emplace_back([&task, i]{ task(i); });
+        }
+        task(0);
+        for (auto& thread: threads) {
+            thread.join();
+        }
+    }
+
+    /**
+     * This function splits one partition of a string for
+     * SplitViewParallel.  Every partition which doesn't extend to
+     * the end of the string ends just after a delimiter.
+     *
+     * Since each piece is trimmed, splitting the partition at every
+     * delimiter and trimming each piece has the same result as
+     * SplitPieces, except for pieces which trim down to nothing.
+     * When the delimiter is itself trimmable, SplitPieces trims it
+     * along with the rest of each run of trimmable characters, so no
+     * such piece is kept.  Otherwise, only the last piece of the
+     * whole string is dropped when it is empty.
+     *
+     * @param[in] partition
+     *     This is the partition to split.
+     *
+     * @param[in] d
+     *     This is the delimiter character.
+     *
+     * @param[in] last
+     *     This indicates whether or not the partition extends
+     *     to the end of the string.
+     *
+     * @param[out] values
+     *     This is where to store the pieces of the partition.
+     */
+    void SplitPartition(
+        std::string_view partition,
+        char d,
+        bool last,
+        std::vector< std::string_view >& values
+    ) {
+        const auto dropEmptyPieces = StringExtensions::IsTrimmable(d);
+        for (;;) {
+            const auto next = (const char*)memchr(partition.data(), d, partition.length());
+            if (next == nullptr) {
+                break;
+            }
+            const auto pieceLength = (size_t)(next - partition.data());
+            const auto piece = StringExtensions::TrimView(partition.substr(0, pieceLength));
+            if (
+                !piece.empty()
+                || !dropEmptyPieces
+            ) {
+                values.push_back(piece);
+            }
+            partition.remove_prefix(pieceLength + 1);
+        }
+        const auto piece = StringExtensions::TrimView(partition);
+        if (
+            last
+            && !piece.empty()
+        ) {
+            values.push_back(piece);
+        }
+    }
+
+}
+
 namespace StringExtensions {
 
     std::string vsprintf(const char* format, va_list args) {
@@ -47,44 +797,34 @@ namespace StringExtensions {
     }
 
     std::string Trim(const std::string& s) {
-        size_t i = 0;
-        while (
-            (i < s.length())
-            && (s[i] <= 32)
-        ) {
-            ++i;
-        }
-        size_t j = s.length();
-        while (
-            (j > 0)
-            && (s[j - 1] <= 32)
-        ) {
-            --j;
-        }
-        return s.substr(i, j - i);
+        return std::string(TrimView(s));
     }
 
     std::string Indent(std::string linesIn, size_t spaces) {
-        std::string linesOut;
-        while (!linesIn.empty()) {
-            std::string line;
-            auto delimiter = linesIn.find("\r\n");
-            if (delimiter == std::string::npos) {
-                line = linesIn;
-                linesIn.clear();
+        StringBuilder linesOut;
+        std::string_view rest(linesIn);
+        while (!rest.empty()) {
+            auto lineLength = rest.find("\r\n");
+            if (lineLength == std::string_view::npos) {
+                lineLength = rest.length();
             } else {
-                line = linesIn.substr(0, delimiter + 2);
-                linesIn = linesIn.substr(delimiter + 2);
+                lineLength += 2;
             }
-            if (!linesOut.empty()) {
-                linesOut.append(spaces, ' ');
+            if (!linesOut.IsEmpty()) {
+                linesOut.Append(spaces, ' ');
             }
-            linesOut += line;
+            linesOut.Append(rest.substr(0, lineLength));
+            rest.remove_prefix(lineLength);
         }
-        return linesOut;
+        return linesOut.ToString();
     }
 
-    std::string ParseComponent(const std::string& s, size_t begin, size_t end) {
+    size_t ScanComponent(
+        std::string_view s,
+        size_t begin,
+        size_t end,
+        bool& closed
+    ) {
         bool inString = false;
         int level = 1;
         size_t j = begin;
@@ -129,53 +869,328 @@ namespace StringExtensions {
             }
             ++j;
         }
+        closed = (level == 0);
+        return j;
+    }
+
+    std::string ParseComponent(const std::string& s, size_t begin, size_t end) {
+        bool closed;
+        const auto j = ScanComponent(s, begin, end, closed);
         return s.substr(begin, j - begin);
     }
 
     std::string Escape(const std::string& s, char escapeCharacter, const std::set< char >& charactersToEscape) {
+        return Escape(s, escapeCharacter, CharSet(charactersToEscape));
+    }
+
+    std::string Escape(const std::string& s, char escapeCharacter, const CharSet& charactersToEscape) {
+        const CharSetScanner scanner(charactersToEscape);
+        const auto end = s.data() + s.length();
+        const auto numEscapes = scanner.Count(s.data(), end);
+        if (numEscapes == 0) {
+            return s;
+        }
+        return EscapeWithScanner(s, 0, escapeCharacter, scanner, numEscapes);
+    }
+
+    bool NeedsEscaping(std::string_view s, const CharSet& charactersToEscape) {
+        const CharSetScanner scanner(charactersToEscape);
+        const auto end = s.data() + s.length();
+        return (scanner.Find(s.data(), end) != end);
+    }
+
+    EscapedString EscapeIfNeeded(std::string_view s, char escapeCharacter, const CharSet& charactersToEscape) {
+        const CharSetScanner scanner(charactersToEscape);
+        const auto end = s.data() + s.length();
+        const auto first = scanner.Find(s.data(), end);
+        if (first == end) {
+            return EscapedString(s);
+        }
+        const auto numEscapes = scanner.Count(first, end);
+        return EscapedString(
+            EscapeWithScanner(s, first - s.data(), escapeCharacter, scanner, numEscapes)
+        );
+    }
+
+    std::string Unescape(const std::string& s, char escapeCharacter) {
         std::string output;
-        for (size_t i = 0; i < s.length(); ++i) {
-            if (charactersToEscape.find(s[i]) != charactersToEscape.end()) {
-                output += escapeCharacter;
+        output.reserve(s.length());
+        auto p = s.data();
+        const auto end = p + s.length();
+        while (p != end) {
+            const auto next = (const char*)memchr(p, escapeCharacter, end - p);
+            if (next == nullptr) {
+                output.append(p, end - p);
+                break;
+            }
+            output.append(p, next - p);
+            p = next + 1;
+            if (p != end) {
+                output += *p++;
             }
-            output += s[i];
         }
         return output;
     }
 
-    std::string Unescape(const std::string& s, char escapeCharacter) {
+    void UnescapeInPlace(std::string& s, char escapeCharacter) {
+        const auto begin = s.data();
+        const auto end = begin + s.length();
+        auto read = begin;
+        auto write = begin;
+        while (read != end) {
+            auto next = (char*)memchr(read, escapeCharacter, end - read);
+            if (next == nullptr) {
+                next = end;
+            }
+            const auto runLength = (size_t)(next - read);
+            if (write != read) {
+                (void)memmove(write, read, runLength);
+            }
+            write += runLength;
+            if (next == end) {
+                break;
+            }
+            read = next + 1;
+            if (read != end) {
+                *write++ = *read++;
+            }
+        }
+        s.resize(write - begin);
+    }
+
+    std::string EscapeJson(std::string_view s) {
+        static const char hexDigits[] = "0123456789abcdef";
         std::string output;
-        bool escape = false;
-        for (size_t i = 0; i < s.length(); ++i) {
-            if (
-                !escape
-                && (s[i] == escapeCharacter)
-            ) {
-                escape = true;
-            } else {
-                output += s[i];
-                escape = false;
+        output.reserve(s.length());
+        auto p = s.data();
+        const auto end = p + s.length();
+        for (;;) {
+            const auto next = FindJsonSpecial(p, end);
+            output.append(p, next - p);
+            if (next == end) {
+                break;
+            }
+            switch (*next) {
+                case '"': output += "\\\""; break;
+                case '\\': output += "\\\\"; break;
+                case '\b': output += "\\b"; break;
+                case '\f': output += "\\f"; break;
+                case '\n': output += "\\n"; break;
+                case '\r': output += "\\r"; break;
+                case '\t': output += "\\t"; break;
+                default: {
+                    output += "\\u00";
+                    output += hexDigits[(uint8_t)*next >> 4];
+                    output += hexDigits[(uint8_t)*next & 0x0F];
+                } break;
+            }
+            p = next + 1;
+        }
+        return output;
+    }
+
+    bool UnescapeJson(std::string_view s, std::string& output) {
+        output.clear();
+        output.reserve(s.length());
+        size_t i = 0;
+        while (i < s.length()) {
+            const auto next = (const char*)memchr(s.data() + i, '\\', s.length() - i);
+            if (next == nullptr) {
+                output.append(s.data() + i, s.length() - i);
+                break;
+            }
+            const auto escape = (size_t)(next - s.data());
+            output.append(s.data() + i, escape - i);
+            if (escape + 1 >= s.length()) {
+                return false;
+            }
+            i = escape + 2;
+            switch (s[escape + 1]) {
+                case '"': output += '"'; break;
+                case '\\': output += '\\'; break;
+                case '/': output += '/'; break;
+                case 'b': output += '\b'; break;
+                case 'f': output += '\f'; break;
+                case 'n': output += '\n'; break;
+                case 'r': output += '\r'; break;
+                case 't': output += '\t'; break;
+                case 'u': {
+                    uint32_t codePoint;
+                    if (!ParseHexDigits(s, i, 4, codePoint)) {
+                        return false;
+                    }
+                    i += 4;
+                    if (
+                        (codePoint >= 0xD800)
+                        && (codePoint <= 0xDBFF)
+                    ) {
+                        uint32_t lowSurrogate;
+                        if (
+                            (s.substr(i, 2) != "\\u")
+                            || !ParseHexDigits(s, i + 2, 4, lowSurrogate)
+                            || (lowSurrogate < 0xDC00)
+                            || (lowSurrogate > 0xDFFF)
+                        ) {
+                            return false;
+                        }
+                        i += 6;
+                        codePoint = (
+                            0x10000
+                            + ((codePoint - 0xD800) << 10)
+                            + (lowSurrogate - 0xDC00)
+                        );
+                    } else if (IsSurrogate(codePoint)) {
+                        return false;
+                    }
+                    AppendUtf8(output, codePoint);
+                } break;
+                default: return false;
             }
         }
+        return true;
+    }
+
+    std::string EscapeCLiteral(std::string_view s) {
+        std::string output;
+        output.reserve(s.length());
+        auto p = s.data();
+        const auto end = p + s.length();
+        for (;;) {
+            const auto next = FindCLiteralSpecial(p, end);
+            output.append(p, next - p);
+            if (next == end) {
+                break;
+            }
+            switch (*next) {
+                case '"': output += "\\\""; break;
+                case '\\': output += "\\\\"; break;
+                case '\a': output += "\\a"; break;
+                case '\b': output += "\\b"; break;
+                case '\f': output += "\\f"; break;
+                case '\n': output += "\\n"; break;
+                case '\r': output += "\\r"; break;
+                case '\t': output += "\\t"; break;
+                case '\v': output += "\\v"; break;
+                default: {
+                    // Octal escapes are used because they never take more
+                    // than three digits, so they can't absorb any digits
+                    // which happen to follow them.
+                    const auto value = (uint8_t)*next;
+                    output += '\\';
+                    output += (char)('0' + (value >> 6));
+                    output += (char)('0' + ((value >> 3) & 7));
+                    output += (char)('0' + (value & 7));
+                } break;
+            }
+            p = next + 1;
+        }
         return output;
     }
 
+    bool UnescapeCLiteral(std::string_view s, std::string& output) {
+        output.clear();
+        output.reserve(s.length());
+        size_t i = 0;
+        while (i < s.length()) {
+            const auto next = (const char*)memchr(s.data() + i, '\\', s.length() - i);
+            if (next == nullptr) {
+                output.append(s.data() + i, s.length() - i);
+                break;
+            }
+            const auto escape = (size_t)(next - s.data());
+            output.append(s.data() + i, escape - i);
+            if (escape + 1 >= s.length()) {
+                return false;
+            }
+            i = escape + 2;
+            const auto c = s[escape + 1];
+            switch (c) {
+                case '"': output += '"'; break;
+                case '\'': output += '\''; break;
+                case '?': output += '?'; break;
+                case '\\': output += '\\'; break;
+                case 'a': output += '\a'; break;
+                case 'b': output += '\b'; break;
+                case 'f': output += '\f'; break;
+                case 'n': output += '\n'; break;
+                case 'r': output += '\r'; break;
+                case 't': output += '\t'; break;
+                case 'v': output += '\v'; break;
+                case 'x': {
+                    uint32_t value = 0;
+                    const auto firstDigit = i;
+                    while (
+                        (i < s.length())
+                        && (HexDigitValue(s[i]) >= 0)
+                    ) {
+                        value = (value << 4) + (uint32_t)HexDigitValue(s[i]);
+                        if (value > 0xFF) {
+                            return false;
+                        }
+                        ++i;
+                    }
+                    if (i == firstDigit) {
+                        return false;
+                    }
+                    output += (char)value;
+                } break;
+                case 'u':
+                case 'U': {
+                    const size_t numDigits = ((c == 'u') ? 4 : 8);
+                    uint32_t codePoint;
+                    if (
+                        !ParseHexDigits(s, i, numDigits, codePoint)
+                        || IsSurrogate(codePoint)
+                        || (codePoint > 0x10FFFF)
+                    ) {
+                        return false;
+                    }
+                    i += numDigits;
+                    AppendUtf8(output, codePoint);
+                } break;
+                default: {
+                    if ((c < '0') || (c > '7')) {
+                        return false;
+                    }
+                    uint32_t value = (uint32_t)(c - '0');
+                    for (
+                        size_t numDigits = 1;
+                        (numDigits < 3)
+                        && (i < s.length())
+                        && (s[i] >= '0')
+                        && (s[i] <= '7');
+                        ++numDigits, ++i
+                    ) {
+                        value = (value << 3) + (uint32_t)(s[i] - '0');
+                    }
+                    if (value > 0xFF) {
+                        return false;
+                    }
+                    output += (char)value;
+                } break;
+            }
+        }
+        return true;
+    }
+
+    size_t Find(
+        std::string_view haystack,
+        std::string_view needle,
+        size_t position
+    ) {
+        return Searcher(needle).Find(haystack, position);
+    }
+
     std::vector< std::string > Split(
         const std::string& s,
         char d
     ) {
         std::vector< std::string > values;
-        auto remainder = Trim(s);
-        while (!remainder.empty()) {
-            auto delimiter = remainder.find_first_of(d);
-            if (delimiter == std::string::npos) {
-                values.push_back(remainder);
-                remainder.clear();
-            } else {
-                values.push_back(Trim(remainder.substr(0, delimiter)));
-                remainder = Trim(remainder.substr(delimiter + 1));
-            }
-        }
+        SplitPieces(
+            s,
+            FindCharacter(d),
+            [&values](std::string_view piece){ values.emplace_back(piece); }
+        );
         return values;
     }
 
@@ -184,64 +1199,283 @@ namespace StringExtensions {
         const std::string& d
     ) {
         std::vector< std::string > values;
-        auto remainder = Trim(s);
-        const auto delimiterLength = d.length();
-        while (!remainder.empty()) {
-            auto delimiter = remainder.find(d);
-            if (delimiter == std::string::npos) {
-                values.push_back(remainder);
-                remainder.clear();
-            } else {
-                values.push_back(Trim(remainder.substr(0, delimiter)));
-                remainder = Trim(remainder.substr(delimiter + delimiterLength));
+        SplitPieces(
+            s,
+            FindSubstring(d),
+            [&values](std::string_view piece){ values.emplace_back(piece); }
+        );
+        return values;
+    }
+
+    std::vector< std::string_view > SplitView(
+        std::string_view s,
+        char d
+    ) {
+        std::vector< std::string_view > values;
+        SplitPieces(
+            s,
+            FindCharacter(d),
+            [&values](std::string_view piece){ values.push_back(piece); }
+        );
+        return values;
+    }
+
+    std::vector< std::string_view > SplitView(
+        std::string_view s,
+        std::string_view d
+    ) {
+        std::vector< std::string_view > values;
+        SplitPieces(
+            s,
+            FindSubstring(d),
+            [&values](std::string_view piece){ values.push_back(piece); }
+        );
+        return values;
+    }
+
+    std::vector< std::string > Split(
+        const std::string& s,
+        const CharSet& d
+    ) {
+        std::vector< std::string > values;
+        SplitPieces(
+            s,
+            FindAnyCharacter(d),
+            [&values](std::string_view piece){ values.emplace_back(piece); }
+        );
+        return values;
+    }
+
+    std::vector< std::string_view > SplitView(
+        std::string_view s,
+        const CharSet& d
+    ) {
+        std::vector< std::string_view > values;
+        SplitPieces(
+            s,
+            FindAnyCharacter(d),
+            [&values](std::string_view piece){ values.push_back(piece); }
+        );
+        return values;
+    }
+
+    void SplitInto(
+        std::string_view s,
+        char d,
+        std::vector< std::string >& values
+    ) {
+        AssignPieces(s, FindCharacter(d), values);
+    }
+
+    void SplitInto(
+        std::string_view s,
+        std::string_view d,
+        std::vector< std::string >& values
+    ) {
+        AssignPieces(s, FindSubstring(d), values);
+    }
+
+    void SplitInto(
+        std::string_view s,
+        char d,
+        std::vector< std::string_view >& values
+    ) {
+        values.clear();
+        SplitPieces(
+            s,
+            FindCharacter(d),
+            [&values](std::string_view piece){ values.push_back(piece); }
+        );
+    }
+
+    void SplitInto(
+        std::string_view s,
+        std::string_view d,
+        std::vector< std::string_view >& values
+    ) {
+        values.clear();
+        SplitPieces(
+            s,
+            FindSubstring(d),
+            [&values](std::string_view piece){ values.push_back(piece); }
+        );
+    }
+
+    SplitResult SplitOwning(
+        std::string&& s,
+        char d
+    ) {
+        return SplitResult(std::move(s), d);
+    }
+
+    SplitResult SplitOwning(
+        std::string&& s,
+        std::string_view d
+    ) {
+        return SplitResult(std::move(s), d);
+    }
+
+    PackedStrings SplitPacked(
+        std::string_view s,
+        char d
+    ) {
+        CharSet delimiters;
+        delimiters.Add(d);
+        const CharSetScanner scanner(delimiters);
+        PackedStrings values;
+        values.Reserve(
+            scanner.Count(s.data(), s.data() + s.length()) + 1,
+            s.length()
+        );
+        SplitPieces(
+            s,
+            FindCharacter(d),
+            [&values](std::string_view piece){ (void)values.Append(piece); }
+        );
+        return values;
+    }
+
+    std::vector< std::string_view > SplitViewParallel(
+        std::string_view s,
+        char d,
+        size_t numThreads
+    ) {
+        if (numThreads == 0) {
+            numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+        const auto numPartitions = std::max(
+            std::min(numThreads, s.length() / MIN_PARALLEL_PARTITION_SIZE),
+            (size_t)1
+        );
+        std::vector< size_t > boundaries{0};
+        for (size_t i = 1; i < numPartitions; ++i) {
+            const auto target = std::max(i * (s.length() / numPartitions), boundaries.back());
+            const auto next = (const char*)memchr(s.data() + target, d, s.length() - target);
+            boundaries.push_back(
+                (next == nullptr)
+                ? s.length()
+                : (size_t)(next - s.data()) + 1
+            );
+        }
+        boundaries.push_back(s.length());
+        std::vector< std::vector< std::string_view > > partitionValues(numPartitions);
+        RunInParallel(
+            numPartitions,
+            [&](size_t i){
+                SplitPartition(
+                    s.substr(boundaries[i], boundaries[i + 1] - boundaries[i]),
+                    d,
+                    (boundaries[i + 1] == s.length()),
+                    partitionValues[i]
+                );
             }
+        );
+        if (numPartitions == 1) {
+            return std::move(partitionValues[0]);
         }
+        std::vector< size_t > offsets{0};
+        for (const auto& values: partitionValues) {
+            offsets.push_back(offsets.back() + values.size());
+        }
+        std::vector< std::string_view > values(offsets.back());
+        RunInParallel(
+            numPartitions,
+            [&](size_t i){
+                std::copy(
+                    partitionValues[i].begin(),
+                    partitionValues[i].end(),
+                    values.begin() + offsets[i]
+                );
+            }
+        );
         return values;
     }
 
-    std::string Join(
-        const std::vector< std::string >& v,
-        char d
+    std::vector< QuotedField > SplitQuoted(
+        std::string_view s,
+        char d,
+        char quote
     ) {
-        std::ostringstream builder;
-        bool first = true;
-        for (const auto& piece: v) {
-            if (first) {
-                first = false;
+        std::vector< QuotedField > fields;
+        size_t fieldStart = 0;
+        uint64_t withinQuotes = 0;
+        for (size_t blockStart = 0; blockStart < s.length(); blockStart += QUOTED_BLOCK_SIZE) {
+            uint64_t quotes, delimiters;
+            const auto blockLength = std::min(QUOTED_BLOCK_SIZE, s.length() - blockStart);
+            if (blockLength == QUOTED_BLOCK_SIZE) {
+                FindQuotesAndDelimiters(s.data() + blockStart, d, quote, quotes, delimiters);
             } else {
-                builder << d;
+                char block[QUOTED_BLOCK_SIZE] = {0};
+                (void)memcpy(block, s.data() + blockStart, blockLength);
+                FindQuotesAndDelimiters(block, d, quote, quotes, delimiters);
+                const auto valid = ((uint64_t)1 << blockLength) - 1;
+                quotes &= valid;
+                delimiters &= valid;
+            }
+
+            // The carried state has every bit set if the previous
+            // block ended within quotes, which flips the parity of
+            // every position in this block.
+            const auto quoted = PrefixXor(quotes) ^ withinQuotes;
+            withinQuotes = (uint64_t)0 - (quoted >> (QUOTED_BLOCK_SIZE - 1));
+            auto fieldEnds = delimiters & ~quoted;
+            while (fieldEnds != 0) {
+                const auto fieldEnd = blockStart + Simd::CountTrailingZeros(fieldEnds);
+                fields.push_back(
+                    MakeQuotedField(
+                        s.substr(fieldStart, fieldEnd - fieldStart),
+                        quote,
+                        true
+                    )
+                );
+                fieldStart = fieldEnd + 1;
+                fieldEnds &= fieldEnds - 1;
             }
-            builder << piece;
         }
-        return builder.str();
+        fields.push_back(
+            MakeQuotedField(
+                s.substr(fieldStart),
+                quote,
+                (withinQuotes == 0)
+            )
+        );
+        return fields;
+    }
+
+    std::string Join(
+        const std::vector< std::string >& v,
+        char d
+    ) {
+        return Join(v, std::string_view(&d, 1));
     }
 
     std::string Join(
         const std::vector< std::string >& v,
         const std::string& d
     ) {
-        std::ostringstream builder;
-        bool first = true;
-        for (const auto& piece: v) {
-            if (first) {
-                first = false;
-            } else {
-                builder << d;
-            }
-            builder << piece;
-        }
-        return builder.str();
+        return Join(v, std::string_view(d));
     }
 
     std::string ToLower(const std::string& inString) {
-        std::string outString;
-        outString.reserve(inString.size());
-        for (char c: inString) {
-            outString.push_back(tolower(c));
-        }
+        std::string outString(inString.length(), '\0');
+        ChangeCase(inString.data(), &outString[0], inString.length(), 'A', 'a' - 'A');
+        return outString;
+    }
+
+    std::string ToUpper(const std::string& inString) {
+        std::string outString(inString.length(), '\0');
+        ChangeCase(inString.data(), &outString[0], inString.length(), 'a', 'A' - 'a');
         return outString;
     }
 
+    void ToLowerInPlace(std::string& s) {
+        ChangeCase(s.data(), &s[0], s.length(), 'A', 'a' - 'A');
+    }
+
+    void ToUpperInPlace(std::string& s) {
+        ChangeCase(s.data(), &s[0], s.length(), 'a', 'A' - 'a');
+    }
+
     ToIntegerResult ToInteger(
         const std::string& numberString,
         intmax_t& number
@@ -320,7 +1554,7 @@ namespace StringExtensions {
         const std::string& templateText,
         const std::map< std::string, std::string >& variables
     ) {
-        std::ostringstream builder;
+        StringBuilder builder;
         enum class State {
             Normal,
             Escape,
@@ -336,13 +1570,13 @@ namespace StringExtensions {
                     } else if (c == '$') {
                         state = State::TokenStart;
                     } else {
-                        builder << c;
+                        builder.Append(c);
                     }
                 } break;
 
                 case State::Escape: {
                     state = State::Normal;
-                    builder << c;
+                    builder.Append(c);
                 } break;
 
                 case State::TokenStart: {
@@ -351,7 +1585,8 @@ namespace StringExtensions {
                         token.clear();
                     } else {
                         state = State::Normal;
-                        builder << '$' << c;
+                        builder.Append('$');
+                        builder.Append(c);
                     }
                 } break;
 
@@ -359,7 +1594,7 @@ namespace StringExtensions {
                     if (c == '}') {
                         const auto variablesEntry = variables.find(token);
                         if (variablesEntry != variables.end()) {
-                            builder << variablesEntry->second;
+                            builder.Append(variablesEntry->second);
                         }
                         state = State::Normal;
                     } else {
@@ -370,7 +1605,7 @@ namespace StringExtensions {
                 default: break;
             }
         }
-        return builder.str();
+        return builder.ToString();
     }
 
 }
@@ -0,0 +1,94 @@
+/**
+ * @file Unescaper.cpp
+ *
+ * This module contains the implementation of the
+ * StringExtensions::Unescaper class.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <string.h>
+#include <StringExtensions/Unescaper.hpp>
+#include <utility>
+
+namespace StringExtensions {
+
+    /**
+     * This contains the private properties of an Unescaper instance.
+     */
+    struct Unescaper::Impl {
+        /**
+         * This is the character to remove from the input.
+         */
+        char escapeCharacter;
+
+        /**
+         * This is where to deliver the unescaped text.
+         */
+        Sink sink;
+
+        /**
+         * This indicates whether or not the last chunk of input
+         * ended with an escape character which has not yet
+         * been applied.
+         */
+        bool escapePending = false;
+    };
+
+    Unescaper::~Unescaper() noexcept = default;
+    Unescaper::Unescaper(Unescaper&&) noexcept = default;
+    Unescaper& Unescaper::operator=(Unescaper&&) noexcept = default;
+
+    Unescaper::Unescaper(
+        char escapeCharacter,
+        Sink sink
+    )
+        : impl_(new Impl{escapeCharacter, std::move(sink)})
+    {
+    }
+
+    void Unescaper::Write(std::string_view chunk) {
+        auto runStart = chunk.data();
+        const auto end = runStart + chunk.length();
+        if (runStart == end) {
+            return;
+        }
+        auto searchStart = runStart;
+        if (impl_->escapePending) {
+            // The first character of this chunk was escaped at the end
+            // of the last chunk, so it is kept as-is to start the
+            // first run.
+            impl_->escapePending = false;
+            ++searchStart;
+        }
+        for (;;) {
+            const auto next = (const char*)memchr(
+                searchStart,
+                impl_->escapeCharacter,
+                end - searchStart
+            );
+            if (next == nullptr) {
+                if (runStart != end) {
+                    impl_->sink(std::string_view(runStart, end - runStart));
+                }
+                break;
+            }
+            if (next != runStart) {
+                impl_->sink(std::string_view(runStart, next - runStart));
+            }
+            if (next + 1 == end) {
+                impl_->escapePending = true;
+                break;
+            }
+
+            // The escaped character is kept as-is to start the next run.
+            runStart = next + 1;
+            searchStart = next + 2;
+        }
+    }
+
+    bool Unescaper::IsEscapePending() const {
+        return impl_->escapePending;
+    }
+
+}
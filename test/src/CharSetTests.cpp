@@ -0,0 +1,85 @@
+/**
+ * @file CharSetTests.cpp
+ *
+ * This module contains the unit tests of the
+ * StringExtensions::CharSet class.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <gtest/gtest.h>
+#include <set>
+#include <string>
+#include <StringExtensions/CharSet.hpp>
+#include <StringExtensions/StringExtensions.hpp>
+
+TEST(CharSetTests, EmptySetContainsNothing) {
+    const StringExtensions::CharSet set;
+    EXPECT_TRUE(set.IsEmpty());
+    EXPECT_EQ(0, set.GetSize());
+    for (int c = 0; c < 256; ++c) {
+        EXPECT_FALSE(set.Contains((char)c));
+    }
+}
+
+TEST(CharSetTests, ConstructedAtCompileTime) {
+    constexpr StringExtensions::CharSet set(" \t,;");
+    static_assert(set.Contains(' '), "space should be in the set");
+    static_assert(set.Contains(';'), "semicolon should be in the set");
+    static_assert(!set.Contains('a'), "letters should not be in the set");
+    static_assert(set.GetSize() == 4, "set should have four members");
+    EXPECT_TRUE(set.Contains('\t'));
+    EXPECT_FALSE(set.Contains('.'));
+}
+
+TEST(CharSetTests, HighCharacters) {
+    StringExtensions::CharSet set;
+    set.Add('\xff').Add('\x80').Add('\0');
+    EXPECT_EQ(3, set.GetSize());
+    EXPECT_TRUE(set.Contains('\xff'));
+    EXPECT_TRUE(set.Contains('\x80'));
+    EXPECT_TRUE(set.Contains('\0'));
+    EXPECT_FALSE(set.Contains('\x7f'));
+    EXPECT_FALSE(set.Contains('\x81'));
+}
+
+TEST(CharSetTests, AddRange) {
+    StringExtensions::CharSet set;
+    set.AddRange('a', 'z').AddRange('\xf0', '\xff');
+    EXPECT_EQ(26 + 16, set.GetSize());
+    EXPECT_TRUE(set.Contains('a'));
+    EXPECT_TRUE(set.Contains('m'));
+    EXPECT_TRUE(set.Contains('z'));
+    EXPECT_TRUE(set.Contains('\xff'));
+    EXPECT_FALSE(set.Contains('A'));
+    EXPECT_FALSE(set.Contains('\xef'));
+}
+
+TEST(CharSetTests, FromStdSet) {
+    const std::set< char > characters{'x', 'y', '\xfe'};
+    const StringExtensions::CharSet set(characters);
+    EXPECT_EQ(3, set.GetSize());
+    for (int c = 0; c < 256; ++c) {
+        EXPECT_EQ(
+            characters.find((char)c) != characters.end(),
+            set.Contains((char)c)
+        );
+    }
+}
+
+TEST(CharSetTests, EscapeWithCharSetMatchesStdSet) {
+    const std::string line = "Hello, W^orld!";
+    constexpr StringExtensions::CharSet charactersToEscape(" !^");
+    EXPECT_EQ(
+        "Hello,^ W^^orld^!",
+        StringExtensions::Escape(line, '^', charactersToEscape)
+    );
+    EXPECT_EQ(
+        StringExtensions::Escape(line, '^', {' ', '!', '^'}),
+        StringExtensions::Escape(line, '^', charactersToEscape)
+    );
+    EXPECT_EQ(
+        "Hello,^ W^^orld^!",
+        StringExtensions::Escape(line, '^', StringExtensions::CharSet(" !^"))
+    );
+}
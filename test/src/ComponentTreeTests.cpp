@@ -0,0 +1,105 @@
+/**
+ * @file ComponentTreeTests.cpp
+ *
+ * This module contains the unit tests of the
+ * StringExtensions::ComponentTree class.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <StringExtensions/ComponentTree.hpp>
+#include <StringExtensions/StringExtensions.hpp>
+
+TEST(ComponentTreeTests, RootIsWholeTrimmedText) {
+    const std::string text = "  {abc, def}  ";
+    const StringExtensions::ComponentTree tree(text);
+    const auto root = tree.GetRoot();
+    ASSERT_TRUE((bool)root);
+    EXPECT_EQ("{abc, def}", root.GetText());
+    EXPECT_EQ(text.data() + 2, root.GetText().data());
+}
+
+TEST(ComponentTreeTests, NestedChildren) {
+    const std::string text = "{abc, [1, 2, {x, y}], \"hello, {world}\", (p), <>}";
+    const StringExtensions::ComponentTree tree(text);
+    const auto root = tree.GetRoot();
+    ASSERT_EQ(5, root.GetNumChildren());
+    EXPECT_EQ("abc", root[0].GetText());
+    EXPECT_EQ("[1, 2, {x, y}]", root[1].GetText());
+    EXPECT_EQ("\"hello, {world}\"", root[2].GetText());
+    EXPECT_EQ("(p)", root[3].GetText());
+    EXPECT_EQ("<>", root[4].GetText());
+    EXPECT_EQ(0, root[0].GetNumChildren());
+    EXPECT_EQ(0, root[2].GetNumChildren());
+    EXPECT_EQ(0, root[4].GetNumChildren());
+    ASSERT_EQ(3, root[1].GetNumChildren());
+    EXPECT_EQ("1", root[1][0].GetText());
+    EXPECT_EQ("2", root[1][1].GetText());
+    ASSERT_EQ(2, root[1][2].GetNumChildren());
+    EXPECT_EQ("x", root[1][2][0].GetText());
+    EXPECT_EQ("y", root[1][2][1].GetText());
+    EXPECT_EQ("p", root[3][0].GetText());
+}
+
+TEST(ComponentTreeTests, ChildrenAreViewsIntoOriginalText) {
+    const std::string text = "[alpha, [beta]]";
+    const StringExtensions::ComponentTree tree(text);
+    const auto beta = tree.GetRoot()[1][0];
+    EXPECT_EQ("beta", beta.GetText());
+    EXPECT_EQ(text.data() + 9, beta.GetText().data());
+}
+
+TEST(ComponentTreeTests, MatchesParseComponent) {
+    const std::string text = "{abc {x} = def, \"q\\\"}\", 42}";
+    const StringExtensions::ComponentTree tree(text);
+    const auto root = tree.GetRoot();
+    ASSERT_EQ(3, root.GetNumChildren());
+    EXPECT_EQ(
+        StringExtensions::ParseComponent(text, 1, text.length()),
+        root[0].GetText()
+    );
+    EXPECT_EQ("\"q\\\"}\"", root[1].GetText());
+    EXPECT_EQ("42", root[2].GetText());
+}
+
+TEST(ComponentTreeTests, EmptyAndUnterminatedContainers) {
+    const std::string text = "{ {}, [a,], (b";
+    const StringExtensions::ComponentTree tree(text);
+    const auto root = tree.GetRoot();
+    ASSERT_EQ(3, root.GetNumChildren());
+    EXPECT_EQ(0, root[0].GetNumChildren());
+    ASSERT_EQ(2, root[1].GetNumChildren());
+    EXPECT_EQ("a", root[1][0].GetText());
+    EXPECT_EQ("", root[1][1].GetText());
+    EXPECT_EQ("(b", root[2].GetText());
+    ASSERT_EQ(1, root[2].GetNumChildren());
+    EXPECT_EQ("b", root[2][0].GetText());
+}
+
+TEST(ComponentTreeTests, MissingChildIsNullNode) {
+    const std::string text = "{a}";
+    const StringExtensions::ComponentTree tree(text);
+    const auto missing = tree.GetRoot()[1];
+    EXPECT_FALSE((bool)missing);
+    EXPECT_EQ("", missing.GetText());
+    EXPECT_EQ(0, missing.GetNumChildren());
+}
+
+TEST(ComponentTreeTests, ManyChildren) {
+    std::string text = "[";
+    for (size_t i = 0; i < 1000; ++i) {
+        if (i > 0) {
+            text += ",";
+        }
+        text += "{" + std::to_string(i) + "}";
+    }
+    text += "]";
+    const StringExtensions::ComponentTree tree(text);
+    const auto root = tree.GetRoot();
+    ASSERT_EQ(1000, root.GetNumChildren());
+    for (size_t i = 0; i < 1000; ++i) {
+        EXPECT_EQ(std::to_string(i), root[i][0].GetText());
+    }
+}
@@ -0,0 +1,57 @@
+/**
+ * @file EscaperTests.cpp
+ *
+ * This module contains the unit tests of the
+ * StringExtensions::Escaper class.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <StringExtensions/Escaper.hpp>
+#include <StringExtensions/StringExtensions.hpp>
+#include <vector>
+
+TEST(EscaperTests, SingleChunkMatchesEscape) {
+    std::string output;
+    StringExtensions::Escaper escaper(
+        '^',
+        StringExtensions::CharSet(" !^"),
+        [&output](std::string_view data){ output += data; }
+    );
+    escaper.Write("Hello, W^orld!");
+    EXPECT_EQ("Hello,^ W^^orld^!", output);
+}
+
+TEST(EscaperTests, AnyChunkingMatchesEscape) {
+    const std::string input = "^^a b!!c^ ^d e f!^";
+    const StringExtensions::CharSet charactersToEscape(" !^");
+    const auto expected = StringExtensions::Escape(input, '^', charactersToEscape);
+    for (size_t chunkSize = 1; chunkSize <= input.length(); ++chunkSize) {
+        std::string output;
+        StringExtensions::Escaper escaper(
+            '^',
+            charactersToEscape,
+            [&output](std::string_view data){ output += data; }
+        );
+        for (size_t i = 0; i < input.length(); i += chunkSize) {
+            escaper.Write(std::string_view(input).substr(i, chunkSize));
+        }
+        EXPECT_EQ(expected, output) << "chunk size: " << chunkSize;
+    }
+}
+
+TEST(EscaperTests, CleanRunsAreNotCopied) {
+    const std::string input = "abc^def";
+    std::vector< const char* > pieces;
+    StringExtensions::Escaper escaper(
+        '\\',
+        StringExtensions::CharSet("^"),
+        [&pieces](std::string_view data){ pieces.push_back(data.data()); }
+    );
+    escaper.Write(input);
+    ASSERT_EQ(3, pieces.size());
+    EXPECT_EQ(input.data(), pieces[0]);
+    EXPECT_EQ(input.data() + 3, pieces[2]);
+}
@@ -0,0 +1,80 @@
+/**
+ * @file JoinIovTests.cpp
+ *
+ * This module contains the unit tests of the
+ * StringExtensions::JoinIov function.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#ifndef _WIN32
+
+#include <array>
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+#include <StringExtensions/Join.hpp>
+#include <StringExtensions/JoinIov.hpp>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+    /**
+     * This function gathers the text which the given I/O vectors
+     * point at into one string.
+     *
+     * @param[in] vectors
+     *     These are the I/O vectors to gather.
+     *
+     * @return
+     *     The gathered text is returned.
+     */
+    std::string Gather(const std::vector< struct iovec >& vectors) {
+        std::string text;
+        for (const auto& vector: vectors) {
+            text.append((const char*)vector.iov_base, vector.iov_len);
+        }
+        return text;
+    }
+
+}
+
+TEST(JoinIovTests, PointsAtPiecesAndDelimiter) {
+    const std::vector< std::string > pieces{"Hello", "World", "!"};
+    const std::string_view d = ", ";
+    const auto vectors = StringExtensions::JoinIov(pieces, d);
+    ASSERT_EQ(5, vectors.size());
+    for (size_t i = 0; i < pieces.size(); ++i) {
+        EXPECT_EQ(pieces[i].data(), vectors[i * 2].iov_base);
+        EXPECT_EQ(pieces[i].length(), vectors[i * 2].iov_len);
+    }
+    EXPECT_EQ(d.data(), vectors[1].iov_base);
+    EXPECT_EQ(d.data(), vectors[3].iov_base);
+    EXPECT_EQ(StringExtensions::Join(pieces, d), Gather(vectors));
+}
+
+TEST(JoinIovTests, EmptyPiecesLeftOut) {
+    const std::array< const char*, 4 > pieces{{"", "a", "", "b"}};
+    const auto vectors = StringExtensions::JoinIov(pieces, ",");
+    EXPECT_EQ(5, vectors.size());
+    EXPECT_EQ(",a,,b", Gather(vectors));
+    EXPECT_EQ("ab", Gather(StringExtensions::JoinIov(pieces, "")));
+    EXPECT_TRUE(StringExtensions::JoinIov(std::vector< std::string >(), ",").empty());
+}
+
+TEST(JoinIovTests, WriteToPipe) {
+    const std::vector< std::string_view > pieces{"foo", "bar", "baz"};
+    const auto vectors = StringExtensions::JoinIov(pieces, "::");
+    int fds[2];
+    ASSERT_EQ(0, pipe(fds));
+    EXPECT_EQ(13, writev(fds[1], vectors.data(), (int)vectors.size()));
+    char buffer[32];
+    const auto amountRead = read(fds[0], buffer, sizeof(buffer));
+    (void)close(fds[0]);
+    (void)close(fds[1]);
+    ASSERT_EQ(13, amountRead);
+    EXPECT_EQ("foo::bar::baz", std::string(buffer, (size_t)amountRead));
+}
+
+#endif /* _WIN32 */
@@ -0,0 +1,118 @@
+/**
+ * @file JoinTests.cpp
+ *
+ * This module contains the unit tests of the versions of the
+ * StringExtensions::Join function which join any range of strings.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <array>
+#include <gtest/gtest.h>
+#include <list>
+#include <stdint.h>
+#include <string>
+#include <string_view>
+#include <StringExtensions/Join.hpp>
+#include <StringExtensions/StringExtensions.hpp>
+#include <vector>
+
+TEST(JoinTests, StringViews) {
+    const std::vector< std::string_view > pieces{"Hello", "World!"};
+    EXPECT_EQ("Hello:World!", StringExtensions::Join(pieces, ':'));
+    EXPECT_EQ("Hello, World!", StringExtensions::Join(pieces, ", "));
+}
+
+TEST(JoinTests, NullTerminatedStrings) {
+    const std::array< const char*, 3 > pieces{{"a", "", "c"}};
+    EXPECT_EQ("a,,c", StringExtensions::Join(pieces, ','));
+}
+
+TEST(JoinTests, OtherContainers) {
+    const std::list< std::string > pieces{"x", "y", "z"};
+    EXPECT_EQ("x::y::z", StringExtensions::Join(pieces, "::"));
+}
+
+TEST(JoinTests, EmptyAndSinglePieces) {
+    EXPECT_EQ("", StringExtensions::Join(std::vector< std::string_view >{}, ", "));
+    EXPECT_EQ("only", StringExtensions::Join(std::vector< std::string_view >{"only"}, ", "));
+}
+
+TEST(JoinTests, LongResult) {
+    const std::vector< std::string > pieces(100, std::string(50, 'x'));
+    const auto result = StringExtensions::Join(pieces, ", ");
+    EXPECT_EQ(100 * 50 + 99 * 2, result.length());
+    EXPECT_EQ(std::string(50, 'x') + ", ", result.substr(0, 52));
+}
+
+TEST(JoinTests, VectorOfStringsMatchesRange) {
+    const std::vector< std::string > pieces{"Hello", "", "World!"};
+    const std::vector< std::string_view > views(pieces.begin(), pieces.end());
+    EXPECT_EQ(StringExtensions::Join(views, ','), StringExtensions::Join(pieces, ','));
+    EXPECT_EQ(StringExtensions::Join(views, "--"), StringExtensions::Join(pieces, "--"));
+}
+
+TEST(JoinTests, JoinIntoAppends) {
+    const std::vector< std::string_view > pieces{"a", "b", "c"};
+    std::string out = "record: ";
+    StringExtensions::JoinInto(out, pieces, ", ");
+    EXPECT_EQ("record: a, b, c", out);
+    StringExtensions::JoinInto(out, pieces, ';');
+    EXPECT_EQ("record: a, b, ca;b;c", out);
+    StringExtensions::JoinInto(out, std::vector< std::string_view >{}, ';');
+    EXPECT_EQ("record: a, b, ca;b;c", out);
+}
+
+TEST(JoinTests, JoinIntoReusesCapacity) {
+    const std::vector< std::string > pieces(10, std::string(20, 'x'));
+    std::string out;
+    out.reserve(1000);
+    const auto buffer = out.data();
+    for (size_t i = 0; i < 3; ++i) {
+        out.clear();
+        StringExtensions::JoinInto(out, pieces, ',');
+        EXPECT_EQ(10 * 20 + 9, out.length());
+        EXPECT_EQ(buffer, out.data());
+    }
+}
+
+TEST(JoinTests, IntegerProjection) {
+    const std::vector< int > numbers{1, -20, 300};
+    EXPECT_EQ("1,-20,300", StringExtensions::Join(numbers, ',', StringExtensions::AppendInteger()));
+    const std::vector< uint64_t > big{UINT64_MAX, 0};
+    EXPECT_EQ(
+        "18446744073709551615 | 0",
+        StringExtensions::Join(big, " | ", StringExtensions::AppendInteger())
+    );
+    const std::vector< int8_t > small{INT8_MIN, INT8_MAX};
+    EXPECT_EQ("-128,127", StringExtensions::Join(small, ',', StringExtensions::AppendInteger()));
+}
+
+TEST(JoinTests, MemberProjection) {
+    struct Person {
+        std::string name;
+        int age;
+    };
+    const std::vector< Person > people{{"Alice", 30}, {"Bob", 25}};
+    EXPECT_EQ(
+        "Alice, Bob",
+        StringExtensions::Join(people, ", ", StringExtensions::AppendMember(&Person::name))
+    );
+}
+
+TEST(JoinTests, CustomProjection) {
+    const std::vector< std::pair< std::string, int > > pairs{{"a", 1}, {"b", 2}};
+    std::string out = "{";
+    StringExtensions::JoinInto(
+        out,
+        pairs,
+        ',',
+        [](std::string& out, const std::pair< std::string, int >& pair){
+            out += pair.first;
+            out += '=';
+            StringExtensions::AppendInteger()(out, pair.second);
+        }
+    );
+    out += '}';
+    EXPECT_EQ("{a=1,b=2}", out);
+}
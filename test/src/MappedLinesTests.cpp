@@ -0,0 +1,133 @@
+/**
+ * @file MappedLinesTests.cpp
+ *
+ * This module contains the unit tests of the
+ * StringExtensions::MappedLines class.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <gtest/gtest.h>
+#include <stdio.h>
+#include <string>
+#include <StringExtensions/MappedLines.hpp>
+#include <StringExtensions/StringExtensions.hpp>
+#include <vector>
+
+namespace {
+
+    /**
+     * This is the path of the file used by the tests.
+     */
+    const std::string TEST_FILE_PATH = "MappedLinesTests.txt";
+
+    /**
+     * This function replaces the contents of the test file
+     * with the given text.
+     *
+     * @param[in] text
+     *     This is the text to write to the test file.
+     */
+    void WriteTestFile(const std::string& text) {
+        const auto file = fopen(TEST_FILE_PATH.c_str(), "wb");
+        ASSERT_FALSE(file == NULL);
+        EXPECT_EQ(text.length(), fwrite(text.data(), 1, text.length(), file));
+        (void)fclose(file);
+    }
+
+    /**
+     * This function reads all the lines of the test file.
+     *
+     * @return
+     *     The lines of the test file are returned.
+     */
+    std::vector< std::string > ReadTestFile() {
+        StringExtensions::MappedLines lines;
+        EXPECT_TRUE(lines.Open(TEST_FILE_PATH));
+        std::vector< std::string > values;
+        std::string_view line;
+        while (lines.NextLine(line)) {
+            values.emplace_back(line);
+        }
+        return values;
+    }
+
+}
+
+/**
+ * This is the test fixture for these tests, providing common
+ * setup and teardown for each test.
+ */
+struct MappedLinesTests
+    : public ::testing::Test
+{
+    // ::testing::Test
+
+    virtual void TearDown() override {
+        (void)remove(TEST_FILE_PATH.c_str());
+    }
+};
+
+TEST_F(MappedLinesTests, Lines) {
+    WriteTestFile("Hello, World!\r\n\nlast line");
+    EXPECT_EQ(
+        (std::vector< std::string >{"Hello, World!", "", "last line"}),
+        ReadTestFile()
+    );
+    WriteTestFile("one\ntwo\n");
+    EXPECT_EQ(
+        (std::vector< std::string >{"one", "two"}),
+        ReadTestFile()
+    );
+}
+
+TEST_F(MappedLinesTests, EmptyFile) {
+    WriteTestFile("");
+    StringExtensions::MappedLines lines;
+    EXPECT_TRUE(lines.Open(TEST_FILE_PATH));
+    EXPECT_EQ(0, lines.GetSize());
+    std::string_view line;
+    EXPECT_FALSE(lines.NextLine(line));
+}
+
+TEST_F(MappedLinesTests, MissingFile) {
+    StringExtensions::MappedLines lines;
+    EXPECT_FALSE(lines.Open("no such file"));
+    std::string_view line;
+    EXPECT_FALSE(lines.NextLine(line));
+}
+
+TEST_F(MappedLinesTests, Records) {
+    WriteTestFile("a, b, c\n1,2\n");
+    StringExtensions::MappedLines lines;
+    ASSERT_TRUE(lines.Open(TEST_FILE_PATH));
+    std::vector< std::string_view > fields;
+    ASSERT_TRUE(lines.NextRecord(',', fields));
+    EXPECT_EQ((std::vector< std::string_view >{"a", "b", "c"}), fields);
+    ASSERT_TRUE(lines.NextRecord(',', fields));
+    EXPECT_EQ((std::vector< std::string_view >{"1", "2"}), fields);
+    EXPECT_FALSE(lines.NextRecord(',', fields));
+}
+
+TEST_F(MappedLinesTests, LargeFileLinesStayReadable) {
+    std::string text;
+    size_t numLines = 0;
+    while (text.length() < (40 << 20)) {
+        text += "line " + std::to_string(numLines++) + "\n";
+    }
+    WriteTestFile(text);
+    StringExtensions::MappedLines lines;
+    ASSERT_TRUE(lines.Open(TEST_FILE_PATH));
+    EXPECT_EQ(text.length(), lines.GetSize());
+    std::string_view first, line;
+    ASSERT_TRUE(lines.NextLine(first));
+    size_t i = 1;
+    while (lines.NextLine(line)) {
+        if (line != "line " + std::to_string(i)) {
+            FAIL() << "line " << i << " is \"" << line << "\"";
+        }
+        ++i;
+    }
+    EXPECT_EQ(numLines, i);
+    EXPECT_EQ("line 0", first);
+}
@@ -0,0 +1,96 @@
+/**
+ * @file PackedStringsTests.cpp
+ *
+ * This module contains the unit tests of the
+ * StringExtensions::PackedStrings class.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <gtest/gtest.h>
+#include <stdint.h>
+#include <string>
+#include <string_view>
+#include <StringExtensions/PackedStrings.hpp>
+#include <StringExtensions/StringExtensions.hpp>
+#include <vector>
+
+TEST(PackedStringsTests, AppendAndIndex) {
+    StringExtensions::PackedStrings strings;
+    EXPECT_TRUE(strings.IsEmpty());
+    EXPECT_EQ(0, strings.GetSize());
+    EXPECT_TRUE(strings.begin() == strings.end());
+    EXPECT_TRUE(strings.Append("Hello"));
+    EXPECT_TRUE(strings.Append(""));
+    EXPECT_TRUE(strings.Append("World!"));
+    ASSERT_EQ(3, strings.GetSize());
+    EXPECT_FALSE(strings.IsEmpty());
+    EXPECT_EQ("Hello", strings[0]);
+    EXPECT_EQ("", strings[1]);
+    EXPECT_EQ("World!", strings[2]);
+    EXPECT_EQ("HelloWorld!", strings.GetBuffer());
+    EXPECT_EQ(strings.GetBuffer().data() + 5, strings[2].data());
+}
+
+TEST(PackedStringsTests, Iterate) {
+    StringExtensions::PackedStrings strings;
+    const std::vector< std::string_view > expected{"a", "bc", "", "def"};
+    for (const auto s: expected) {
+        (void)strings.Append(s);
+    }
+    std::vector< std::string_view > actual;
+    for (const auto s: strings) {
+        actual.push_back(s);
+    }
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(PackedStringsTests, ClearKeepsMemory) {
+    StringExtensions::PackedStrings strings;
+    strings.Reserve(2, 100);
+    (void)strings.Append("first");
+    const auto buffer = strings.GetBuffer().data();
+    strings.Clear();
+    EXPECT_EQ(0, strings.GetSize());
+    (void)strings.Append("second");
+    EXPECT_EQ(buffer, strings.GetBuffer().data());
+    EXPECT_EQ("second", strings[0]);
+}
+
+TEST(PackedStringsTests, TooLongMarksTruncated) {
+    StringExtensions::PackedStrings strings;
+    EXPECT_TRUE(strings.Append("first"));
+    EXPECT_FALSE(strings.IsTruncated());
+
+    // The length is checked before anything is copied, so the
+    // characters of this view are never read.
+    const char c = 'x';
+    EXPECT_FALSE(strings.Append(std::string_view(&c, UINT32_MAX)));
+    EXPECT_TRUE(strings.IsTruncated());
+    EXPECT_FALSE(strings.Append("second"));
+    EXPECT_EQ(1, strings.GetSize());
+    EXPECT_EQ("first", strings[0]);
+    strings.Clear();
+    EXPECT_FALSE(strings.IsTruncated());
+    EXPECT_TRUE(strings.Append("third"));
+}
+
+TEST(PackedStringsTests, SplitPackedMatchesSplit) {
+    const std::vector< std::string > lines{
+        "",
+        "   ",
+        "Hello, World!",
+        "  a , , b , ",
+        ",,a,,",
+        std::string(100, 'x') + "," + std::string(100, 'y'),
+    };
+    for (const auto& line: lines) {
+        const auto packed = StringExtensions::SplitPacked(line, ',');
+        const auto copies = StringExtensions::Split(line, ',');
+        EXPECT_FALSE(packed.IsTruncated()) << line;
+        ASSERT_EQ(copies.size(), packed.GetSize()) << line;
+        for (size_t i = 0; i < copies.size(); ++i) {
+            EXPECT_EQ(copies[i], packed[i]) << line;
+        }
+    }
+}
@@ -0,0 +1,40 @@
+/**
+ * @file QuotedFieldTests.cpp
+ *
+ * This module contains the unit tests of the
+ * StringExtensions::QuotedField class.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <StringExtensions/QuotedField.hpp>
+
+TEST(QuotedFieldTests, UnquotedValueIsText) {
+    const StringExtensions::QuotedField field("a\"\"b", false);
+    EXPECT_FALSE(field.IsQuoted());
+    EXPECT_EQ("a\"\"b", field.GetText());
+    EXPECT_EQ("a\"\"b", field.GetValue());
+}
+
+TEST(QuotedFieldTests, QuotedValueIsUnescaped) {
+    const std::string text = "say \"\"hi\"\", \"\"\"\"";
+    const StringExtensions::QuotedField field(text, true);
+    EXPECT_TRUE(field.IsQuoted());
+    EXPECT_EQ(text, field.GetText());
+    EXPECT_EQ(text.data(), field.GetText().data());
+    EXPECT_EQ("say \"hi\", \"\"", field.GetValue());
+}
+
+TEST(QuotedFieldTests, OtherQuoteCharacter) {
+    const StringExtensions::QuotedField field("it''s \"here\"", true, '\'');
+    EXPECT_EQ("it's \"here\"", field.GetValue());
+}
+
+TEST(QuotedFieldTests, DefaultIsEmpty) {
+    const StringExtensions::QuotedField field;
+    EXPECT_FALSE(field.IsQuoted());
+    EXPECT_EQ("", field.GetText());
+    EXPECT_EQ("", field.GetValue());
+}
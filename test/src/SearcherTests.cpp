@@ -0,0 +1,146 @@
+/**
+ * @file SearcherTests.cpp
+ *
+ * This module contains the unit tests of the
+ * StringExtensions::Searcher class.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include <stdint.h>
+#include <string>
+#include <StringExtensions/Searcher.hpp>
+#include <StringExtensions/StringExtensions.hpp>
+
+namespace {
+
+    /**
+     * This function makes a string of the given length from a small
+     * alphabet, so that partial matches of needles are common.
+     *
+     * @param[in] length
+     *     This is the length of the string to make.
+     *
+     * @param[in,out] state
+     *     This is the state of the pseudo-random number generator
+     *     used to pick characters.
+     *
+     * @return
+     *     The generated string is returned.
+     */
+    std::string MakeText(size_t length, uint32_t& state) {
+        std::string text;
+        for (size_t i = 0; i < length; ++i) {
+            state = state * 1103515245 + 12345;
+            text.push_back((char)('a' + (state >> 16) % 3));
+        }
+        return text;
+    }
+
+}
+
+TEST(SearcherTests, MatchesStdFind) {
+    uint32_t state = 42;
+    const auto haystack = MakeText(2000, state);
+    for (size_t needleLength = 0; needleLength <= 80; ++needleLength) {
+        for (size_t trial = 0; trial < 8; ++trial) {
+            std::string needle;
+            if (trial % 2 == 0) {
+                const auto start = (state >> 8) % (haystack.length() - needleLength);
+                needle = haystack.substr(start, needleLength);
+                state = state * 1103515245 + 12345;
+            } else {
+                needle = MakeText(needleLength, state);
+            }
+            const StringExtensions::Searcher searcher(needle);
+            for (const size_t position: {(size_t)0, (size_t)7, (size_t)1000, (size_t)1999, (size_t)2000, (size_t)2001}) {
+                ASSERT_EQ(
+                    std::string_view(haystack).find(needle, position),
+                    searcher.Find(haystack, position)
+                ) << "needle: " << needle << " position: " << position;
+            }
+        }
+    }
+}
+
+TEST(SearcherTests, MatchAtVeryEnd) {
+    const std::string needle = "--boundary-1234567890-abcdefghijklmnop";
+    for (size_t prefix = 0; prefix < 40; ++prefix) {
+        const auto haystack = std::string(prefix, '-') + needle;
+        EXPECT_EQ(prefix, StringExtensions::Searcher(needle).Find(haystack));
+        EXPECT_EQ(prefix, StringExtensions::Searcher(needle.substr(30)).Find(haystack) - 30);
+        EXPECT_EQ(std::string_view::npos, StringExtensions::Searcher(needle + "x").Find(haystack));
+    }
+}
+
+TEST(SearcherTests, HighBytes) {
+    const std::string haystack = "\x01\x80\xff\xfe\x80\xff\xfe\x00\x7f";
+    EXPECT_EQ(4, StringExtensions::Find(haystack, "\x80\xff\xfe", 2));
+    EXPECT_EQ(std::string_view::npos, StringExtensions::Find(haystack, "\xff\xff"));
+}
+
+TEST(SearcherTests, Reusable) {
+    const StringExtensions::Searcher searcher("::");
+    EXPECT_EQ("::", searcher.GetNeedle());
+    EXPECT_EQ(1, searcher.Find("a::b::c"));
+    EXPECT_EQ(4, searcher.Find("a::b::c", 2));
+    EXPECT_EQ(std::string_view::npos, searcher.Find("a::b::c", 5));
+}
+
+TEST(SearcherTests, LongNeedlesMatchStdFind) {
+    uint32_t state = 7;
+    for (size_t needleLength: {32, 33, 40, 64, 100, 257}) {
+        for (size_t trial = 0; trial < 50; ++trial) {
+            // Haystacks and needles made from just two letters, often
+            // repeating, give the Two-Way algorithm's periodic and
+            // non-periodic cases a good workout.
+            std::string haystack;
+            const auto unit = MakeText(1 + trial % 7, state);
+            while (haystack.length() < 4000) {
+                haystack += unit;
+                state = state * 1103515245 + 12345;
+                if ((state >> 16) % 5 == 0) {
+                    haystack += MakeText(1, state);
+                }
+            }
+            for (auto& c: haystack) {
+                if (c == 'c') {
+                    c = 'a';
+                }
+            }
+            const auto start = (state >> 8) % (haystack.length() - needleLength);
+            auto needle = haystack.substr(start, needleLength);
+            if (trial % 2 == 1) {
+                needle[(state >> 4) % needleLength] ^= 3;
+            }
+            const StringExtensions::Searcher searcher(needle);
+            for (const size_t position: {(size_t)0, (size_t)1, (size_t)start, (size_t)start + 1}) {
+                ASSERT_EQ(
+                    std::string_view(haystack).find(needle, position),
+                    searcher.Find(haystack, position)
+                ) << "needle: " << needle << " position: " << position;
+            }
+        }
+    }
+}
+
+TEST(SearcherTests, LongAdversarialNeedle) {
+    // The first and last bytes of this needle match at every position
+    // of the haystack, and so do all the bytes in between but one.
+    // Comparing the needle at every position would compare over
+    // a hundred billion bytes, so a bound on the time taken catches
+    // any search which does.
+    const size_t needleLength = 8192;
+    std::string needle(needleLength, 'a');
+    needle[needleLength - 2] = 'b';
+    std::string haystack(16 * 1024 * 1024, 'a');
+    const StringExtensions::Searcher searcher(needle);
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(std::string_view::npos, searcher.Find(haystack));
+    haystack[haystack.length() - 2] = 'b';
+    EXPECT_EQ(haystack.length() - needleLength, searcher.Find(haystack));
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT_LT(elapsed, std::chrono::seconds(1));
+}
@@ -0,0 +1,69 @@
+/**
+ * @file SinkTests.cpp
+ *
+ * This module contains the unit tests of the
+ * StringExtensions::Sink helpers.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <functional>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <StringExtensions/Escaper.hpp>
+#include <StringExtensions/Sink.hpp>
+#include <vector>
+
+TEST(SinkTests, StreamSink) {
+    std::ostringstream stream;
+    const auto sink = StringExtensions::MakeStreamSink(stream);
+    sink("Hello, ");
+    sink("World!");
+    EXPECT_EQ("Hello, World!", stream.str());
+}
+
+TEST(SinkTests, BufferedSinkCoalescesSmallWrites) {
+    std::vector< std::string > flushes;
+    StringExtensions::BufferedSink sink(
+        8,
+        [&flushes](std::string_view data){ flushes.emplace_back(data); }
+    );
+    sink.Write("abc");
+    sink.Write("def");
+    EXPECT_TRUE(flushes.empty());
+    sink.Write("ghi");
+    sink.Write("");
+    sink.Flush();
+    sink.Flush();
+    EXPECT_EQ(
+        (std::vector< std::string >{"abcdef", "ghi"}),
+        flushes
+    );
+}
+
+TEST(SinkTests, BufferedSinkPassesLargeWritesThrough) {
+    std::vector< std::string > flushes;
+    StringExtensions::BufferedSink sink(
+        4,
+        [&flushes](std::string_view data){ flushes.emplace_back(data); }
+    );
+    sink.Write("ab");
+    sink.Write("cdefgh");
+    sink.Write("ijkl");
+    sink.Flush();
+    EXPECT_EQ(
+        (std::vector< std::string >{"ab", "cdefgh", "ijkl"}),
+        flushes
+    );
+}
+
+TEST(SinkTests, EscaperIntoBufferedStreamSink) {
+    std::ostringstream stream;
+    StringExtensions::BufferedSink buffered(16, StringExtensions::MakeStreamSink(stream));
+    StringExtensions::Escaper escaper('^', StringExtensions::CharSet(" !^"), std::ref(buffered));
+    escaper.Write("Hello, W^");
+    escaper.Write("orld!");
+    buffered.Flush();
+    EXPECT_EQ("Hello,^ W^^orld^!", stream.str());
+}
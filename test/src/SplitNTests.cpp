@@ -0,0 +1,97 @@
+/**
+ * @file SplitNTests.cpp
+ *
+ * This module contains the unit tests of the
+ * StringExtensions::SplitN function template.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <StringExtensions/SplitN.hpp>
+#include <StringExtensions/StringExtensions.hpp>
+#include <vector>
+
+TEST(SplitNTests, HostAndPort) {
+    const std::string address = " example.com : 8080 ";
+    const auto result = StringExtensions::SplitN< 2 >(address, ':');
+    EXPECT_EQ(2, result.count);
+    EXPECT_FALSE(result.overflow);
+    EXPECT_EQ("example.com", result.pieces[0]);
+    EXPECT_EQ("8080", result.pieces[1]);
+    EXPECT_EQ(address.data() + 1, result.pieces[0].data());
+}
+
+TEST(SplitNTests, FewerPieces) {
+    const auto result = StringExtensions::SplitN< 3 >("key", '=');
+    EXPECT_EQ(1, result.count);
+    EXPECT_FALSE(result.overflow);
+    EXPECT_EQ("key", result.pieces[0]);
+    EXPECT_EQ("", result.pieces[1]);
+    EXPECT_EQ(0, StringExtensions::SplitN< 3 >("  ", '=').count);
+}
+
+TEST(SplitNTests, TooManyPieces) {
+    const auto result = StringExtensions::SplitN< 2 >("a=b=c", '=');
+    EXPECT_EQ(2, result.count);
+    EXPECT_TRUE(result.overflow);
+    EXPECT_EQ("a", result.pieces[0]);
+    EXPECT_EQ("b", result.pieces[1]);
+}
+
+TEST(SplitNTests, MatchesSplit) {
+    const std::vector< std::string > lines{
+        "",
+        "Hello, World!",
+        "  a , , b , ",
+        ",,a,,",
+    };
+    for (const auto& line: lines) {
+        const auto result = StringExtensions::SplitN< 8 >(line, ',');
+        const auto copies = StringExtensions::Split(line, ',');
+        ASSERT_EQ(copies.size(), result.count) << line;
+        for (size_t i = 0; i < copies.size(); ++i) {
+            EXPECT_EQ(copies[i], result.pieces[i]) << line;
+        }
+    }
+}
+
+TEST(SplitNTests, OtherPolicy) {
+    const auto result = StringExtensions::SplitN<
+        3,
+        StringExtensions::RawSplitPolicy
+    >(" a,b ,", ',');
+    EXPECT_EQ(3, result.count);
+    EXPECT_FALSE(result.overflow);
+    EXPECT_EQ(" a", result.pieces[0]);
+    EXPECT_EQ("b ", result.pieces[1]);
+    EXPECT_EQ("", result.pieces[2]);
+}
+
+TEST(SplitNTests, DroppedEmptyPiecesDontCount) {
+    using DropEmpty = StringExtensions::SplitPolicy< true, StringExtensions::EmptyPieces::Drop >;
+    auto result = StringExtensions::SplitN< 2, DropEmpty >("a,,b,c", ',');
+    EXPECT_EQ(2, result.count);
+    EXPECT_TRUE(result.overflow);
+    EXPECT_EQ("a", result.pieces[0]);
+    EXPECT_EQ("b", result.pieces[1]);
+    result = StringExtensions::SplitN< 2, DropEmpty >("a,,b,,", ',');
+    EXPECT_EQ(2, result.count);
+    EXPECT_FALSE(result.overflow);
+    EXPECT_EQ("a", result.pieces[0]);
+    EXPECT_EQ("b", result.pieces[1]);
+}
+
+TEST(SplitNTests, CompileTime) {
+    constexpr auto result = StringExtensions::SplitN< 2 >("localhost : 80", ':');
+    static_assert(result.count == 2, "two pieces should be found");
+    static_assert(!result.overflow, "the pieces should fit");
+    static_assert(result.pieces[0] == "localhost", "host should be first");
+    static_assert(result.pieces[1] == "80", "port should be second");
+    static_assert(
+        StringExtensions::SplitN< 1 >("a:b", ':').overflow,
+        "the pieces shouldn't fit"
+    );
+    EXPECT_EQ("80", result.pieces[1]);
+}
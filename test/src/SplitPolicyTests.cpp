@@ -0,0 +1,100 @@
+/**
+ * @file SplitPolicyTests.cpp
+ *
+ * This module contains the unit tests of the
+ * StringExtensions::SplitPolicy template and the policy-based
+ * Split and SplitView functions.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <StringExtensions/SplitPolicy.hpp>
+#include <StringExtensions/StringExtensions.hpp>
+#include <vector>
+
+TEST(SplitPolicyTests, DefaultPolicyMatchesSplit) {
+    const std::vector< std::string > lines{
+        "",
+        "   ",
+        ",",
+        "Hello, World!",
+        "  a , , b , ",
+        "a,b,c,",
+        ",,a,,",
+        "a :: b::::c ::",
+    };
+    for (const auto& line: lines) {
+        for (const auto d: {',', ' '}) {
+            EXPECT_EQ(
+                StringExtensions::Split(line, d),
+                StringExtensions::Split< StringExtensions::SplitPolicy<> >(line, d)
+            ) << line;
+            EXPECT_EQ(
+                StringExtensions::SplitView(line, d),
+                StringExtensions::SplitView< StringExtensions::SplitPolicy<> >(line, d)
+            ) << line;
+        }
+        EXPECT_EQ(
+            StringExtensions::Split(line, "::"),
+            StringExtensions::Split< StringExtensions::SplitPolicy<> >(line, "::")
+        ) << line;
+    }
+}
+
+TEST(SplitPolicyTests, RawPolicyKeepsEverything) {
+    using Policy = StringExtensions::RawSplitPolicy;
+    EXPECT_EQ(
+        (std::vector< std::string >{" a", " ", "b ", ""}),
+        StringExtensions::Split< Policy >(" a, ,b ,", ',')
+    );
+    EXPECT_EQ(
+        (std::vector< std::string >{""}),
+        StringExtensions::Split< Policy >("", ',')
+    );
+    EXPECT_EQ(
+        (std::vector< std::string >{"a", "", "b"}),
+        StringExtensions::Split< Policy >("a::::b", "::")
+    );
+    const std::string line = "x,y";
+    const auto views = StringExtensions::SplitView< Policy >(line, ',');
+    ASSERT_EQ(2, views.size());
+    EXPECT_EQ(line.data() + 2, views[1].data());
+}
+
+TEST(SplitPolicyTests, DropEmptyPieces) {
+    using Policy = StringExtensions::SplitPolicy<
+        true,
+        StringExtensions::EmptyPieces::Drop
+    >;
+    EXPECT_EQ(
+        (std::vector< std::string >{"a", "b"}),
+        StringExtensions::Split< Policy >(" , a,, b ,", ',')
+    );
+    EXPECT_EQ(
+        (std::vector< std::string >{}),
+        StringExtensions::Split< Policy >(",,,", ',')
+    );
+}
+
+TEST(SplitPolicyTests, MaxSplits) {
+    using Policy = StringExtensions::SplitPolicy<
+        true,
+        StringExtensions::EmptyPieces::DropLast,
+        2
+    >;
+    EXPECT_EQ(
+        (std::vector< std::string >{"a", "b", "c, d"}),
+        StringExtensions::Split< Policy >("a, b, c, d", ',')
+    );
+    using FirstOnly = StringExtensions::SplitPolicy<
+        false,
+        StringExtensions::EmptyPieces::Keep,
+        1
+    >;
+    EXPECT_EQ(
+        (std::vector< std::string_view >{"key", "value=with=equals"}),
+        StringExtensions::SplitView< FirstOnly >("key=value=with=equals", '=')
+    );
+}
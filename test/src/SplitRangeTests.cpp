@@ -0,0 +1,92 @@
+/**
+ * @file SplitRangeTests.cpp
+ *
+ * This module contains the unit tests of the
+ * StringExtensions::SplitRange class.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <string>
+#include <StringExtensions/SplitRange.hpp>
+#include <StringExtensions/StringExtensions.hpp>
+#include <vector>
+
+TEST(SplitRangeTests, RangeForMatchesSplitView) {
+    const std::vector< std::string > lines{
+        "",
+        "   ",
+        "Hello, World!",
+        "  a , , b , ",
+        "a,b,c,",
+        ",,a,,",
+        "a :: b::::c ::",
+    };
+    for (const auto& line: lines) {
+        for (const auto d: {',', ' '}) {
+            std::vector< std::string_view > pieces;
+            for (const auto piece: StringExtensions::SplitRange(line, d)) {
+                pieces.push_back(piece);
+            }
+            EXPECT_EQ(StringExtensions::SplitView(line, d), pieces) << line;
+        }
+        std::vector< std::string_view > pieces;
+        for (const auto piece: StringExtensions::SplitRange(line, std::string_view("::"))) {
+            pieces.push_back(piece);
+        }
+        EXPECT_EQ(StringExtensions::SplitView(line, "::"), pieces) << line;
+    }
+}
+
+TEST(SplitRangeTests, EmptySubstringDelimiterDoesNotSplit) {
+    const StringExtensions::SplitRange range(" a,b ", std::string_view());
+    EXPECT_EQ(
+        (std::vector< std::string_view >{"a,b"}),
+        std::vector< std::string_view >(range.begin(), range.end())
+    );
+}
+
+TEST(SplitRangeTests, StandardAlgorithms) {
+    const std::string line = "alpha, beta, gamma, delta";
+    const StringExtensions::SplitRange range(line, ',');
+    EXPECT_EQ(4, std::distance(range.begin(), range.end()));
+    const auto gamma = std::find(range.begin(), range.end(), "gamma");
+    ASSERT_NE(range.end(), gamma);
+    EXPECT_EQ(line.data() + 13, gamma->data());
+    auto next = gamma;
+    EXPECT_EQ("delta", *++next);
+    EXPECT_EQ("gamma", *gamma);
+    EXPECT_EQ(range.end(), ++next);
+}
+
+TEST(SplitRangeTests, PiecesAreFoundOnlyWhenReached) {
+    // Changing the string after the first piece is found, but before
+    // the iterator is advanced, shows the rest was not scanned yet.
+    std::string line = "first,second,third";
+    const StringExtensions::SplitRange range(line, ',');
+    auto it = range.begin();
+    EXPECT_EQ("first", *it);
+    line[12] = ';';
+    EXPECT_EQ("second;third", *++it);
+    EXPECT_EQ(range.end(), ++it);
+}
+
+#if defined(__cpp_lib_ranges)
+TEST(SplitRangeTests, StdRanges) {
+    static_assert(std::ranges::forward_range< StringExtensions::SplitRange >);
+    static_assert(std::ranges::borrowed_range< StringExtensions::SplitRange >);
+    const std::string line = "3, 1, 4, 1, 5";
+    const StringExtensions::SplitRange range(line, ',');
+    EXPECT_EQ(2, std::ranges::count(range, "1"));
+    const auto four = std::ranges::find(StringExtensions::SplitRange(line, ','), "4");
+    EXPECT_EQ("4", *four);
+    std::vector< std::string_view > firstTwo;
+    for (const auto piece: range | std::views::take(2)) {
+        firstTwo.push_back(piece);
+    }
+    EXPECT_EQ((std::vector< std::string_view >{"3", "1"}), firstTwo);
+}
+#endif
@@ -0,0 +1,62 @@
+/**
+ * @file SplitResultTests.cpp
+ *
+ * This module contains the unit tests of the
+ * StringExtensions::SplitResult class.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <StringExtensions/SplitResult.hpp>
+#include <StringExtensions/StringExtensions.hpp>
+#include <utility>
+#include <vector>
+
+TEST(SplitResultTests, PiecesViewTakenString) {
+    std::string line = "  a long line, which won't fit in a short string , , b , ";
+    const auto data = line.data();
+    const auto result = StringExtensions::SplitOwning(std::move(line), ',');
+    EXPECT_EQ(data, result.GetBuffer().data());
+    ASSERT_EQ(4, result.GetSize());
+    EXPECT_EQ("a long line", result[0]);
+    EXPECT_EQ(
+        StringExtensions::Split(std::string(result.GetBuffer()), ','),
+        result.ToStrings()
+    );
+    for (const auto piece: result) {
+        EXPECT_GE(piece.data(), result.GetBuffer().data());
+        EXPECT_LE(
+            piece.data() + piece.length(),
+            result.GetBuffer().data() + result.GetBuffer().length()
+        );
+    }
+}
+
+TEST(SplitResultTests, SubstringDelimiter) {
+    const auto result = StringExtensions::SplitOwning("Hello::World!::This:Day", "::");
+    EXPECT_EQ(
+        (std::vector< std::string >{"Hello", "World!", "This:Day"}),
+        result.ToStrings()
+    );
+}
+
+TEST(SplitResultTests, CopyAndMoveKeepPiecesValid) {
+    for (const auto& line: {std::string("a,b"), std::string(100, 'x') + "," + std::string(100, 'y')}) {
+        auto original = StringExtensions::SplitOwning(std::string(line), ',');
+        const auto expected = original.ToStrings();
+        const auto copy = original;
+        EXPECT_EQ(expected, copy.ToStrings());
+        EXPECT_EQ(copy.GetBuffer().data(), copy[0].data());
+        auto moved = std::move(original);
+        EXPECT_EQ(expected, moved.ToStrings());
+        EXPECT_EQ(moved.GetBuffer().data(), moved[0].data());
+        StringExtensions::SplitResult assigned;
+        assigned = moved;
+        EXPECT_EQ(assigned.GetBuffer().data(), assigned[0].data());
+        assigned = std::move(moved);
+        EXPECT_EQ(expected, assigned.ToStrings());
+        EXPECT_EQ(assigned.GetBuffer().data() + line.find(',') + 1, assigned[1].data());
+    }
+}
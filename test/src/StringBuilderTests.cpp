@@ -0,0 +1,97 @@
+/**
+ * @file StringBuilderTests.cpp
+ *
+ * This module contains the unit tests of the
+ * StringExtensions::StringBuilder class.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+#include <StringExtensions/StringBuilder.hpp>
+#include <utility>
+
+TEST(StringBuilderTests, Empty) {
+    const StringExtensions::StringBuilder builder;
+    EXPECT_TRUE(builder.IsEmpty());
+    EXPECT_EQ(0, builder.GetLength());
+    EXPECT_EQ("", builder.ToString());
+    EXPECT_TRUE(builder.GetChunks().empty());
+}
+
+TEST(StringBuilderTests, AppendPieces) {
+    StringExtensions::StringBuilder builder;
+    builder.Append("Hello");
+    builder.Append(',');
+    builder.Append(3, ' ');
+    builder.Append(std::string("World!"));
+    builder.Append("");
+    builder.Append(0, 'x');
+    EXPECT_FALSE(builder.IsEmpty());
+    EXPECT_EQ(15, builder.GetLength());
+    EXPECT_EQ("Hello,   World!", builder.ToString());
+}
+
+TEST(StringBuilderTests, ManyChunks) {
+    StringExtensions::StringBuilder builder;
+    std::string expected;
+    for (size_t i = 0; i < 2000; ++i) {
+        const auto piece = std::to_string(i * 7919);
+        builder.Append(piece);
+        builder.Append(i % 5, '-');
+        builder.Append('\n');
+        expected += piece;
+        expected.append(i % 5, '-');
+        expected += '\n';
+    }
+    const std::string big(5000, 'z');
+    builder.Append(big);
+    expected += big;
+    EXPECT_EQ(expected.length(), builder.GetLength());
+    EXPECT_EQ(expected, builder.ToString());
+    const auto chunks = builder.GetChunks();
+    EXPECT_GT(chunks.size(), 1);
+    std::string gathered;
+    for (const auto& chunk: chunks) {
+        gathered += chunk;
+    }
+    EXPECT_EQ(expected, gathered);
+}
+
+TEST(StringBuilderTests, WrittenTextNeverMoves) {
+    StringExtensions::StringBuilder builder;
+    builder.Append("first");
+    const auto first = builder.GetChunks()[0];
+    for (size_t i = 0; i < 1000; ++i) {
+        builder.Append("more text");
+    }
+    EXPECT_EQ(first.data(), builder.GetChunks()[0].data());
+    EXPECT_EQ("first", first.substr(0, 5));
+}
+
+TEST(StringBuilderTests, Clear) {
+    StringExtensions::StringBuilder builder;
+    builder.Append(std::string(10000, 'a'));
+    builder.Clear();
+    EXPECT_TRUE(builder.IsEmpty());
+    EXPECT_EQ("", builder.ToString());
+    EXPECT_TRUE(builder.GetChunks().empty());
+    builder.Append("again");
+    EXPECT_EQ("again", builder.ToString());
+    EXPECT_EQ(1, builder.GetChunks().size());
+}
+
+TEST(StringBuilderTests, Move) {
+    StringExtensions::StringBuilder builder;
+    builder.Append("Hello, ");
+    StringExtensions::StringBuilder other(std::move(builder));
+    other.Append("World!");
+    EXPECT_EQ("Hello, World!", other.ToString());
+    EXPECT_TRUE(builder.IsEmpty());
+    builder.Append("reused");
+    EXPECT_EQ("reused", builder.ToString());
+    builder = std::move(other);
+    EXPECT_EQ("Hello, World!", builder.ToString());
+}
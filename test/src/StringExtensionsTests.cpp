@@ -90,6 +90,53 @@ TEST(StringExtensionsTests, Escape) {
     );
 }
 
+TEST(StringExtensionsTests, Escape_Long_Inputs_Small_And_Large_Sets) {
+    std::string line;
+    for (int i = 0; i < 1000; ++i) {
+        line += (char)(i * 7 % 256);
+    }
+    const StringExtensions::CharSet smallSet("^! \x80\xff");
+    StringExtensions::CharSet largeSet;
+    largeSet.AddRange('a', 'z').Add('\0').Add('\x90');
+    for (const auto& set: {smallSet, largeSet}) {
+        for (size_t length = 0; length <= line.length(); length += 37) {
+            const auto input = line.substr(0, length);
+            std::string expected;
+            for (auto c: input) {
+                if (set.Contains(c)) {
+                    expected += '\\';
+                }
+                expected += c;
+            }
+            EXPECT_EQ(expected, StringExtensions::Escape(input, '\\', set));
+        }
+    }
+}
+
+TEST(StringExtensionsTests, NeedsEscaping) {
+    const StringExtensions::CharSet charactersToEscape(" !^");
+    EXPECT_TRUE(StringExtensions::NeedsEscaping("Hello, World!", charactersToEscape));
+    EXPECT_FALSE(StringExtensions::NeedsEscaping("HelloWorld", charactersToEscape));
+    EXPECT_FALSE(StringExtensions::NeedsEscaping("", charactersToEscape));
+    EXPECT_TRUE(StringExtensions::NeedsEscaping(std::string(100, 'x') + "^", charactersToEscape));
+}
+
+TEST(StringExtensionsTests, EscapeIfNeeded) {
+    const StringExtensions::CharSet charactersToEscape(" !^");
+    const std::string clean = "HelloWorld";
+    const auto cleanResult = StringExtensions::EscapeIfNeeded(clean, '^', charactersToEscape);
+    EXPECT_FALSE(cleanResult.IsOwned());
+    EXPECT_EQ(clean.data(), cleanResult.GetView().data());
+    EXPECT_EQ("HelloWorld", cleanResult.GetView());
+    const std::string line = "Hello, W^orld!";
+    auto result = StringExtensions::EscapeIfNeeded(line, '^', charactersToEscape);
+    EXPECT_TRUE(result.IsOwned());
+    EXPECT_EQ("Hello,^ W^^orld^!", result.GetView());
+    const auto moved = std::move(result);
+    EXPECT_EQ("Hello,^ W^^orld^!", moved.GetView());
+    EXPECT_EQ("Hello,^ W^^orld^!", moved.ToString());
+}
+
 TEST(StringExtensionsTests, Unescape) {
     const std::string line = "Hello,^ W^^orld^!";
     ASSERT_EQ(
@@ -98,6 +145,88 @@ TEST(StringExtensionsTests, Unescape) {
     );
 }
 
+TEST(StringExtensionsTests, UnescapeInPlace) {
+    const std::vector< std::pair< std::string, std::string > > testVectors{
+        {"", ""},
+        {"Hello,^ W^^orld^!", "Hello, W^orld!"},
+        {"^^^^", "^^"},
+        {"^", ""},
+        {"abc^", "abc"},
+        {"^a^b^c", "abc"},
+        {std::string(100, 'x') + "^^" + std::string(100, 'y'), std::string(100, 'x') + "^" + std::string(100, 'y')},
+    };
+    for (const auto& testVector: testVectors) {
+        auto s = testVector.first;
+        StringExtensions::UnescapeInPlace(s, '^');
+        EXPECT_EQ(testVector.second, s);
+        EXPECT_EQ(testVector.second, StringExtensions::Unescape(testVector.first, '^'));
+    }
+}
+
+TEST(StringExtensionsTests, EscapeJson) {
+    EXPECT_EQ("", StringExtensions::EscapeJson(""));
+    EXPECT_EQ("Hello, World!", StringExtensions::EscapeJson("Hello, World!"));
+    EXPECT_EQ(
+        "say \\\"hi\\\"\\\\\\b\\f\\n\\r\\t\\u0000\\u001f\x7f/\xc3\xa9",
+        StringExtensions::EscapeJson(std::string("say \"hi\"\\\b\f\n\r\t\0\x1f\x7f/\xc3\xa9", 20))
+    );
+    const std::string longInput = std::string(40, 'x') + "\n" + std::string(40, 'y') + "\"";
+    EXPECT_EQ(
+        std::string(40, 'x') + "\\n" + std::string(40, 'y') + "\\\"",
+        StringExtensions::EscapeJson(longInput)
+    );
+}
+
+TEST(StringExtensionsTests, UnescapeJson) {
+    std::string output;
+    EXPECT_TRUE(StringExtensions::UnescapeJson("say \\\"hi\\\"\\\\\\/\\b\\f\\n\\r\\t", output));
+    EXPECT_EQ("say \"hi\"\\/\b\f\n\r\t", output);
+    EXPECT_TRUE(StringExtensions::UnescapeJson("\\u0041\\u00e9\\u20AC\\ud83d\\ude00", output));
+    EXPECT_EQ("A\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80", output);
+    EXPECT_FALSE(StringExtensions::UnescapeJson("abc\\", output));
+    EXPECT_FALSE(StringExtensions::UnescapeJson("\\x41", output));
+    EXPECT_FALSE(StringExtensions::UnescapeJson("\\u00g1", output));
+    EXPECT_FALSE(StringExtensions::UnescapeJson("\\u004", output));
+    EXPECT_FALSE(StringExtensions::UnescapeJson("\\ud83d", output));
+    EXPECT_FALSE(StringExtensions::UnescapeJson("\\ud83d\\u0041", output));
+    EXPECT_FALSE(StringExtensions::UnescapeJson("\\ude00", output));
+    std::string all;
+    for (int c = 0; c < 256; ++c) {
+        all += (char)c;
+    }
+    EXPECT_TRUE(StringExtensions::UnescapeJson(StringExtensions::EscapeJson(all), output));
+    EXPECT_EQ(all, output);
+}
+
+TEST(StringExtensionsTests, EscapeCLiteral) {
+    EXPECT_EQ("Hello, World!", StringExtensions::EscapeCLiteral("Hello, World!"));
+    EXPECT_EQ(
+        "\\\"\\\\\\a\\b\\f\\n\\r\\t\\v\\000\\0371\\177\\303\\251'?",
+        StringExtensions::EscapeCLiteral(std::string("\"\\\a\b\f\n\r\t\v\0\x1f" "1\x7f\xc3\xa9'?", 17))
+    );
+}
+
+TEST(StringExtensionsTests, UnescapeCLiteral) {
+    std::string output;
+    EXPECT_TRUE(StringExtensions::UnescapeCLiteral("\\\"\\'\\?\\\\\\a\\b\\f\\n\\r\\t\\v", output));
+    EXPECT_EQ("\"'?\\\a\b\f\n\r\t\v", output);
+    EXPECT_TRUE(StringExtensions::UnescapeCLiteral("\\0\\101\\1012\\x41\\x041g\\u00e9\\U0001F600", output));
+    EXPECT_EQ(std::string("\0AA2AAg\xc3\xa9\xf0\x9f\x98\x80", 13), output);
+    EXPECT_FALSE(StringExtensions::UnescapeCLiteral("\\", output));
+    EXPECT_FALSE(StringExtensions::UnescapeCLiteral("\\q", output));
+    EXPECT_FALSE(StringExtensions::UnescapeCLiteral("\\x", output));
+    EXPECT_FALSE(StringExtensions::UnescapeCLiteral("\\x100", output));
+    EXPECT_FALSE(StringExtensions::UnescapeCLiteral("\\400", output));
+    EXPECT_FALSE(StringExtensions::UnescapeCLiteral("\\ud800", output));
+    EXPECT_FALSE(StringExtensions::UnescapeCLiteral("\\U00110000", output));
+    std::string all;
+    for (int c = 0; c < 256; ++c) {
+        all += (char)c;
+    }
+    EXPECT_TRUE(StringExtensions::UnescapeCLiteral(StringExtensions::EscapeCLiteral(all), output));
+    EXPECT_EQ(all, output);
+}
+
 TEST(StringExtensionsTests, Split_Single_Character_Delimiter) {
     const std::string line = "Hello, World!";
     ASSERT_EQ(
@@ -114,6 +243,245 @@ TEST(StringExtensionsTests, Split_Multi_Character_Delimiter) {
     );
 }
 
+TEST(StringExtensionsTests, Split_Trimming_And_Empty_Pieces) {
+    EXPECT_EQ(
+        (std::vector< std::string >{"a", "", "b"}),
+        StringExtensions::Split("  a , , b , ", ',')
+    );
+    EXPECT_EQ(
+        (std::vector< std::string >{"a", "b"}),
+        StringExtensions::Split("a   b", ' ')
+    );
+    EXPECT_EQ(
+        (std::vector< std::string >{}),
+        StringExtensions::Split(" \t ", ',')
+    );
+    EXPECT_EQ(
+        (std::vector< std::string >{"", "a"}),
+        StringExtensions::Split(",a", ',')
+    );
+    EXPECT_EQ(
+        (std::vector< std::string >{"a::b"}),
+        StringExtensions::Split("a::b", "")
+    );
+}
+
+TEST(StringExtensionsTests, SplitView_Matches_Split) {
+    const std::vector< std::string > lines{
+        "",
+        "   ",
+        "Hello, World!",
+        "  a , , b , ",
+        "a,b,c,",
+        ",,a,,",
+        "a :: b::::c ::",
+        "::a",
+        std::string(1000, 'x') + "," + std::string(1000, 'y'),
+    };
+    for (const auto& line: lines) {
+        for (const auto d: {',', ' '}) {
+            const auto views = StringExtensions::SplitView(line, d);
+            const auto copies = StringExtensions::Split(line, d);
+            ASSERT_EQ(copies.size(), views.size()) << line;
+            for (size_t i = 0; i < views.size(); ++i) {
+                EXPECT_EQ(copies[i], views[i]) << line;
+                EXPECT_GE(views[i].data(), line.data());
+                EXPECT_LE(views[i].data() + views[i].length(), line.data() + line.length());
+            }
+        }
+        const auto views = StringExtensions::SplitView(line, "::");
+        const auto copies = StringExtensions::Split(line, "::");
+        ASSERT_EQ(copies.size(), views.size()) << line;
+        for (size_t i = 0; i < views.size(); ++i) {
+            EXPECT_EQ(copies[i], views[i]) << line;
+        }
+    }
+}
+
+TEST(StringExtensionsTests, Split_Character_Set_Delimiter) {
+    const StringExtensions::CharSet delimiters(" \t,;");
+    EXPECT_EQ(
+        (std::vector< std::string >{"a", "b", "c", "d", "", "e"}),
+        StringExtensions::Split("a b\tc,  d;;e", delimiters)
+    );
+    EXPECT_EQ(
+        (std::vector< std::string_view >{"a", "b", "c", "d", "", "e"}),
+        StringExtensions::SplitView("a b\tc,  d;;e", delimiters)
+    );
+    EXPECT_EQ(
+        (std::vector< std::string >{"Hello::World!"}),
+        StringExtensions::Split("Hello::World!", StringExtensions::CharSet())
+    );
+}
+
+TEST(StringExtensionsTests, Split_Character_Set_Matches_Single_Character) {
+    std::string line;
+    for (size_t i = 0; i < 200; ++i) {
+        line += std::string(i % 37, 'x') + ",";
+    }
+    StringExtensions::CharSet largeSet;
+    largeSet.AddRange('a', 'w').Add(',');
+    for (const auto& set: {StringExtensions::CharSet(","), largeSet}) {
+        EXPECT_EQ(
+            StringExtensions::Split(line, ','),
+            StringExtensions::Split(line, set)
+        );
+        EXPECT_EQ(
+            StringExtensions::SplitView(line, ','),
+            StringExtensions::SplitView(line, set)
+        );
+    }
+}
+
+TEST(StringExtensionsTests, SplitInto_Reuses_Strings) {
+    std::vector< std::string > values;
+    StringExtensions::SplitInto("a long first field that allocates, b, c", ',', values);
+    EXPECT_EQ(
+        (std::vector< std::string >{"a long first field that allocates", "b", "c"}),
+        values
+    );
+    const auto firstBuffer = values[0].data();
+    const auto vectorBuffer = values.data();
+    StringExtensions::SplitInto("another long first field here :: x", "::", values);
+    EXPECT_EQ(
+        (std::vector< std::string >{"another long first field here", "x"}),
+        values
+    );
+    EXPECT_EQ(firstBuffer, values[0].data());
+    EXPECT_EQ(vectorBuffer, values.data());
+    StringExtensions::SplitInto("", ',', values);
+    EXPECT_TRUE(values.empty());
+}
+
+TEST(StringExtensionsTests, SplitInto_Views) {
+    const std::string line = "  a , , b , ";
+    std::vector< std::string_view > values{"stale"};
+    StringExtensions::SplitInto(line, ',', values);
+    EXPECT_EQ(StringExtensions::SplitView(line, ','), values);
+    StringExtensions::SplitInto(line, " , ", values);
+    EXPECT_EQ(StringExtensions::SplitView(line, " , "), values);
+}
+
+TEST(StringExtensionsTests, SplitViewParallel_Matches_SplitView) {
+    const std::vector< std::string > lines{
+        "",
+        "   ",
+        "Hello, World!",
+        "  a , , b , ",
+        "a,b,c,",
+        ",,a,,",
+        "\n\na\n \nb\n",
+    };
+    for (const auto& line: lines) {
+        for (const auto d: {',', ' ', '\n'}) {
+            EXPECT_EQ(
+                StringExtensions::SplitView(line, d),
+                StringExtensions::SplitViewParallel(line, d, 4)
+            );
+        }
+    }
+}
+
+TEST(StringExtensionsTests, SplitViewParallel_Large_Input) {
+    std::string text;
+    uint32_t seed = 1;
+    while (text.length() < (5 << 20)) {
+        seed = seed * 1103515245 + 12345;
+        text += "ab, \n"[(seed >> 16) % 5];
+    }
+    for (const auto d: {',', ' ', '\n'}) {
+        const auto expected = StringExtensions::SplitView(text, d);
+        for (size_t numThreads = 1; numThreads <= 8; numThreads *= 2) {
+            const auto values = StringExtensions::SplitViewParallel(text, d, numThreads);
+            ASSERT_EQ(expected.size(), values.size());
+            EXPECT_TRUE(expected == values);
+            for (size_t i = 0; i < values.size(); i += 997) {
+                EXPECT_EQ(expected[i].data(), values[i].data());
+            }
+        }
+    }
+    const auto longLine = std::string(3 << 20, 'x') + "," + std::string(10, 'y');
+    EXPECT_EQ(
+        StringExtensions::SplitView(longLine, ','),
+        StringExtensions::SplitViewParallel(longLine, ',', 3)
+    );
+}
+
+TEST(StringExtensionsTests, SplitQuoted) {
+    const std::string record = "abc, \"x,y\",,\"say \"\"hi\"\"\",\"line 1\nline 2\",";
+    const auto fields = StringExtensions::SplitQuoted(record);
+    ASSERT_EQ(6, fields.size());
+    EXPECT_EQ("abc", fields[0].GetText());
+    EXPECT_FALSE(fields[0].IsQuoted());
+    EXPECT_EQ(" \"x,y\"", fields[1].GetText());
+    EXPECT_FALSE(fields[1].IsQuoted());
+    EXPECT_EQ("", fields[2].GetText());
+    EXPECT_EQ("say \"\"hi\"\"", fields[3].GetText());
+    EXPECT_TRUE(fields[3].IsQuoted());
+    EXPECT_EQ("say \"hi\"", fields[3].GetValue());
+    EXPECT_EQ(record.data() + 13, fields[3].GetText().data());
+    EXPECT_EQ("line 1\nline 2", fields[4].GetValue());
+    EXPECT_EQ("", fields[5].GetText());
+}
+
+TEST(StringExtensionsTests, SplitQuoted_Edge_Cases) {
+    auto fields = StringExtensions::SplitQuoted("");
+    ASSERT_EQ(1, fields.size());
+    EXPECT_EQ("", fields[0].GetText());
+    fields = StringExtensions::SplitQuoted("\"\",\"\"\"\"");
+    ASSERT_EQ(2, fields.size());
+    EXPECT_TRUE(fields[0].IsQuoted());
+    EXPECT_EQ("", fields[0].GetValue());
+    EXPECT_EQ("\"", fields[1].GetValue());
+    fields = StringExtensions::SplitQuoted("a;'b;c", ';', '\'');
+    ASSERT_EQ(2, fields.size());
+    EXPECT_EQ("a", fields[0].GetText());
+    EXPECT_TRUE(fields[1].IsQuoted());
+    EXPECT_EQ("b;c", fields[1].GetText());
+    fields = StringExtensions::SplitQuoted("\"abc\"\"");
+    ASSERT_EQ(1, fields.size());
+    EXPECT_EQ("abc\"\"", fields[0].GetText());
+}
+
+TEST(StringExtensionsTests, SplitQuoted_Matches_Character_By_Character_Scan) {
+    uint32_t seed = 1;
+    for (size_t length = 0; length < 300; ++length) {
+        std::string record;
+        for (size_t i = 0; i < length; ++i) {
+            seed = seed * 1103515245 + 12345;
+            record += "ab,\"\n"[(seed >> 16) % 5];
+        }
+        std::vector< std::string > expected;
+        std::string field;
+        bool withinQuotes = false;
+        for (const auto c: record) {
+            if (c == '"') {
+                withinQuotes = !withinQuotes;
+            } else if (
+                (c == ',')
+                && !withinQuotes
+            ) {
+                expected.push_back(field);
+                field.clear();
+                continue;
+            }
+            field += c;
+        }
+        expected.push_back(field);
+        const auto fields = StringExtensions::SplitQuoted(record);
+        ASSERT_EQ(expected.size(), fields.size()) << record;
+        for (size_t i = 0; i < fields.size(); ++i) {
+            const auto text = fields[i].GetText();
+            if (fields[i].IsQuoted()) {
+                EXPECT_EQ('"', expected[i][0]);
+                EXPECT_EQ(expected[i].substr(1, text.length()), text);
+            } else {
+                EXPECT_EQ(expected[i], text);
+            }
+        }
+    }
+}
+
 TEST(StringExtensionsTests, Join_Single_Character_Delimiter) {
     const std::vector< std::string > pieces{"Hello", "World!"};
     ASSERT_EQ(
@@ -143,6 +511,43 @@ TEST(StringExtensionsTests, ToLower) {
     EXPECT_EQ("foo1bar", StringExtensions::ToLower("FOO1BAR"));
 }
 
+TEST(StringExtensionsTests, ToUpper) {
+    EXPECT_EQ("HELLO", StringExtensions::ToUpper("Hello"));
+    EXPECT_EQ("HELLO", StringExtensions::ToUpper("HELLO"));
+    EXPECT_EQ("FOO1BAR", StringExtensions::ToUpper("fOo1bAr"));
+    EXPECT_EQ("", StringExtensions::ToUpper(""));
+}
+
+TEST(StringExtensionsTests, ToLowerAndUpperInPlace) {
+    std::string s = "Hello, World! [The Quick Brown Fox] @`{";
+    StringExtensions::ToLowerInPlace(s);
+    EXPECT_EQ("hello, world! [the quick brown fox] @`{", s);
+    StringExtensions::ToUpperInPlace(s);
+    EXPECT_EQ("HELLO, WORLD! [THE QUICK BROWN FOX] @`{", s);
+}
+
+TEST(StringExtensionsTests, ChangeCaseOnlyAsciiLetters) {
+    std::string all;
+    for (int i = 0; i < 256; ++i) {
+        all.push_back((char)(i + '@'));
+    }
+    for (size_t length = 0; length <= all.length(); ++length) {
+        const auto s = all.substr(0, length);
+        std::string lower, upper;
+        for (auto c: s) {
+            lower.push_back(((c >= 'A') && (c <= 'Z')) ? (char)(c + 32) : c);
+            upper.push_back(((c >= 'a') && (c <= 'z')) ? (char)(c - 32) : c);
+        }
+        EXPECT_EQ(lower, StringExtensions::ToLower(s)) << length;
+        EXPECT_EQ(upper, StringExtensions::ToUpper(s)) << length;
+        auto inPlace = s;
+        StringExtensions::ToLowerInPlace(inPlace);
+        EXPECT_EQ(lower, inPlace) << length;
+        StringExtensions::ToUpperInPlace(inPlace);
+        EXPECT_EQ(upper, inPlace) << length;
+    }
+}
+
 TEST(StringExtensionsTests, ToInteger) {
     struct TestVector {
         std::string input;
@@ -0,0 +1,59 @@
+/**
+ * @file UnescaperTests.cpp
+ *
+ * This module contains the unit tests of the
+ * StringExtensions::Unescaper class.
+ *
+ * © 2019 by Richard Walters
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <StringExtensions/StringExtensions.hpp>
+#include <StringExtensions/Unescaper.hpp>
+
+TEST(UnescaperTests, SingleChunkMatchesUnescape) {
+    std::string output;
+    StringExtensions::Unescaper unescaper(
+        '^',
+        [&output](std::string_view data){ output += data; }
+    );
+    unescaper.Write("Hello,^ W^^orld^!");
+    EXPECT_EQ("Hello, W^orld!", output);
+    EXPECT_FALSE(unescaper.IsEscapePending());
+}
+
+TEST(UnescaperTests, AnyChunkingMatchesUnescape) {
+    const std::string input = "^^a^ b^!^!c^^^ ^^d e f^!^^^";
+    const auto expected = StringExtensions::Unescape(input, '^');
+    for (size_t chunkSize = 1; chunkSize <= input.length(); ++chunkSize) {
+        std::string output;
+        StringExtensions::Unescaper unescaper(
+            '^',
+            [&output](std::string_view data){ output += data; }
+        );
+        for (size_t i = 0; i < input.length(); i += chunkSize) {
+            unescaper.Write(std::string_view(input).substr(i, chunkSize));
+        }
+        EXPECT_EQ(expected, output) << "chunk size: " << chunkSize;
+        EXPECT_TRUE(unescaper.IsEscapePending());
+    }
+}
+
+TEST(UnescaperTests, EscapeCarriedAcrossChunks) {
+    std::string output;
+    StringExtensions::Unescaper unescaper(
+        '^',
+        [&output](std::string_view data){ output += data; }
+    );
+    unescaper.Write("abc^");
+    EXPECT_TRUE(unescaper.IsEscapePending());
+    EXPECT_EQ("abc", output);
+    unescaper.Write("");
+    EXPECT_TRUE(unescaper.IsEscapePending());
+    unescaper.Write("^");
+    EXPECT_FALSE(unescaper.IsEscapePending());
+    EXPECT_EQ("abc^", output);
+    unescaper.Write("^^def");
+    EXPECT_EQ("abc^^def", output);
+}